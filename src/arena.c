@@ -0,0 +1,99 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <errno.h>
+#include <sys/mman.h>
+#include "arena.h"
+
+/*
+ * Buffer arena
+ *
+ * All DSP state and the blocks passed between the pipeline stages are
+ * carved out of one mapping at startup, each piece aligned to a cache
+ * line so no two stages share one. Nothing is ever freed on its own;
+ * the whole arena goes away at exit. Once the pipeline runs, the audio
+ * path doesn't allocate anything. The program has one arena for all
+ * of it (see buffers.c), library instances each have an arena of their
+ * own.
+ */
+
+/* Map an arena of at least size bytes, on huge pages if asked for and
+ * there are any free.
+ */
+int8_t open_arena(struct arena_t *arena, size_t size, uint8_t huge_pages) {
+	void *base = MAP_FAILED;
+
+	memset(arena, 0, sizeof(struct arena_t));
+
+	size = (size + ARENA_PAGE_SIZE - 1) & ~(size_t)(ARENA_PAGE_SIZE - 1);
+
+	if (huge_pages) {
+		base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (base == MAP_FAILED) {
+			fprintf(stderr, "Could not get huge pages (see "
+				"vm.nr_hugepages), using normal pages.\n");
+		} else {
+			arena->on_huge_pages = 1;
+		}
+	}
+
+	if (base == MAP_FAILED) {
+		base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (base == MAP_FAILED) {
+			fprintf(stderr, "Could not allocate buffer memory: %s.\n",
+				strerror(errno));
+			return -1;
+		}
+#ifdef MADV_HUGEPAGE
+		// let transparent huge pages back it if they can
+		if (huge_pages) madvise(base, size, MADV_HUGEPAGE);
+#endif
+	}
+
+	arena->base = base;
+	arena->size = size;
+
+	return 0;
+}
+
+/* Zeroed memory that lives until the arena is closed. Returns NULL once
+ * the arena is used up.
+ */
+void *alloc_from_arena(struct arena_t *arena, size_t size) {
+	void *ptr;
+
+	if (size > arena->size - arena->used) {
+		fprintf(stderr, "Out of buffer memory (%zu bytes needed, %zu "
+			"left).\n", size, arena->size - arena->used);
+		return NULL;
+	}
+
+	ptr = arena->base + arena->used;
+	arena->used += (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+	return ptr;
+}
+
+void close_arena(struct arena_t *arena) {
+	if (arena->base == NULL) return;
+	munmap(arena->base, arena->size);
+	arena->base = NULL;
+}
@@ -0,0 +1,43 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+/* Every arena allocation starts on its own cache line */
+#define ARENA_ALIGN		CACHE_LINE_SIZE
+
+/* Room for the DSP tables and filter state */
+#define DSP_MEMORY_SIZE		(256 * 1024)
+
+/* The arena is a multiple of this, one huge page on most systems */
+#define ARENA_PAGE_SIZE		(2 * 1024 * 1024)
+
+typedef struct arena_t {
+	uint8_t *base;
+	size_t size;
+	size_t used;
+	uint8_t on_huge_pages;
+} arena_t;
+
+extern int8_t open_arena(struct arena_t *arena, size_t size,
+	uint8_t huge_pages);
+extern void *alloc_from_arena(struct arena_t *arena, size_t size);
+extern void close_arena(struct arena_t *arena);
+
+#endif /* ARENA_H */
@@ -0,0 +1,111 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "arena.h"
+#include "buffers.h"
+#include "block_ring.h"
+
+int8_t init_block_ring(struct block_ring_t *ring, size_t block_size,
+	uint32_t num_blocks) {
+	memset(ring, 0, sizeof(struct block_ring_t));
+	ring->blocks = arena_alloc(num_blocks * block_size * sizeof(float));
+	if (ring->blocks == NULL) return -1;
+	ring->block_size = block_size;
+	ring->num_blocks = num_blocks;
+
+	return 0;
+}
+
+/* Sleep until *word is no longer val or the ring is closed. The other
+ * side checks the sleeping flag after it has moved its index and bumps
+ * wake_seq before waking us, so a wakeup cannot be missed.
+ */
+static void ring_wait(struct block_ring_t *ring, uint32_t *word, uint32_t val) {
+	uint32_t seq = __atomic_load_n(&ring->wake_seq, __ATOMIC_SEQ_CST);
+
+	__atomic_store_n(&ring->sleeping, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(word, __ATOMIC_SEQ_CST) != val ||
+		__atomic_load_n(&ring->closed, __ATOMIC_SEQ_CST)) return;
+	syscall(SYS_futex, &ring->wake_seq, FUTEX_WAIT_PRIVATE, seq,
+		NULL, NULL, 0);
+}
+
+static void ring_wake(struct block_ring_t *ring) {
+	if (__atomic_exchange_n(&ring->sleeping, 0, __ATOMIC_SEQ_CST)) {
+		__atomic_add_fetch(&ring->wake_seq, 1, __ATOMIC_SEQ_CST);
+		syscall(SYS_futex, &ring->wake_seq, FUTEX_WAKE_PRIVATE, 1,
+			NULL, NULL, 0);
+	}
+}
+
+/* Wake both sides and make them give up */
+void close_block_ring(struct block_ring_t *ring) {
+	__atomic_store_n(&ring->closed, 1, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&ring->wake_seq, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &ring->wake_seq, FUTEX_WAKE_PRIVATE, INT_MAX,
+		NULL, NULL, 0);
+}
+
+/* Wait for a free block to fill
+ * Returns NULL once the ring is closed
+ */
+float *get_ring_write_block(struct block_ring_t *ring) {
+	uint32_t head = ring->head;
+	uint32_t tail;
+
+	while ((tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) ==
+		head - ring->num_blocks) {
+		if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) return NULL;
+		ring_wait(ring, &ring->tail, tail);
+	}
+	if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) return NULL;
+
+	return ring->blocks + (head & (ring->num_blocks - 1)) * ring->block_size;
+}
+
+/* Hand the block from get_ring_write_block to the reader */
+void commit_ring_block(struct block_ring_t *ring) {
+	__atomic_store_n(&ring->head, ring->head + 1, __ATOMIC_SEQ_CST);
+	ring_wake(ring);
+}
+
+/* Wait for a filled block
+ * Returns NULL once the ring is closed
+ */
+float *get_ring_read_block(struct block_ring_t *ring) {
+	uint32_t tail = ring->tail;
+	uint32_t head;
+
+	while ((head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)) == tail) {
+		if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) return NULL;
+		ring_wait(ring, &ring->head, head);
+	}
+	if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) return NULL;
+
+	return ring->blocks + (tail & (ring->num_blocks - 1)) * ring->block_size;
+}
+
+/* Give the block from get_ring_read_block back to the writer */
+void release_ring_block(struct block_ring_t *ring) {
+	__atomic_store_n(&ring->tail, ring->tail + 1, __ATOMIC_SEQ_CST);
+	ring_wake(ring);
+}
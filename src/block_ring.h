@@ -0,0 +1,53 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Blocks per ring, must be a power of 2 */
+#define DEFAULT_RING_DEPTH	2
+#define MAX_RING_DEPTH		16
+
+/*
+ * Lock-free ring of fixed-size sample blocks
+ *
+ * Connects two pipeline stages: one thread writes blocks, another reads
+ * them. Blocks are filled and read in place. A thread only sleeps when
+ * the ring is full or empty. The indexes of the two sides are kept on
+ * cache lines of their own.
+ */
+typedef struct block_ring_t {
+	float *blocks;
+	// floats per block
+	size_t block_size;
+	uint32_t num_blocks;
+	// only written by the producer
+	uint32_t head __attribute__((aligned(CACHE_LINE_SIZE)));
+	// only written by the consumer
+	uint32_t tail __attribute__((aligned(CACHE_LINE_SIZE)));
+	// set by a thread about to sleep
+	uint32_t sleeping __attribute__((aligned(CACHE_LINE_SIZE)));
+	// bumped to wake a sleeping thread, which sleeps on it
+	uint32_t wake_seq;
+	uint8_t closed;
+} block_ring_t;
+
+extern int8_t init_block_ring(struct block_ring_t *ring, size_t block_size,
+	uint32_t num_blocks);
+extern void close_block_ring(struct block_ring_t *ring);
+extern float *get_ring_write_block(struct block_ring_t *ring);
+extern void commit_ring_block(struct block_ring_t *ring);
+extern float *get_ring_read_block(struct block_ring_t *ring);
+extern void release_ring_block(struct block_ring_t *ring);
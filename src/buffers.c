@@ -0,0 +1,58 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include "arena.h"
+#include "buffers.h"
+
+/*
+ * Program buffers
+ *
+ * The one arena all stations, pipeline stages and DSP tables of the
+ * program are allocated from. Not part of the library, where every
+ * instance brings its own.
+ */
+
+static struct arena_t buffers;
+static uint8_t want_huge_pages;
+
+void set_huge_pages(uint8_t on) {
+	want_huge_pages = on;
+}
+
+int8_t init_arena(size_t size) {
+	return open_arena(&buffers, size, want_huge_pages);
+}
+
+struct arena_t *get_arena() {
+	return &buffers;
+}
+
+void *arena_alloc(size_t size) {
+	return alloc_from_arena(&buffers, size);
+}
+
+void report_arena() {
+	fprintf(stderr, "Using %zu of %zu KiB of buffer memory%s.\n",
+		(buffers.used + 1023) / 1024, buffers.size / 1024,
+		buffers.on_huge_pages ? " on huge pages" : "");
+}
+
+void exit_arena() {
+	close_arena(&buffers);
+}
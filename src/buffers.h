@@ -0,0 +1,30 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUFFERS_H
+#define BUFFERS_H
+
+/* The arena of the program, see arena.h */
+extern void set_huge_pages(uint8_t on);
+extern int8_t init_arena(size_t size);
+extern struct arena_t *get_arena();
+extern void *arena_alloc(size_t size);
+extern void report_arena();
+extern void exit_arena();
+
+#endif /* BUFFERS_H */
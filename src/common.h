@@ -29,4 +29,7 @@
 #define M_PI	3.14159265358979323846
 #endif
 
-#define M_2PI	(M_PI * 2.0)
\ No newline at end of file
+#define M_2PI	(M_PI * 2.0)
+
+/* keeps data written by different threads apart */
+#define CACHE_LINE_SIZE	64
\ No newline at end of file
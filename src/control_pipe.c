@@ -18,52 +18,80 @@
 
 #include "common.h"
 #include <fcntl.h>
+#include <time.h>
 
 #include "rds.h"
+#ifdef RDS2
+#include "rds2.h"
+#endif
 #include "fm_mpx.h"
+#include "schedule.h"
+#include "sequencer.h"
+#include "stats.h"
+#include "event_loop.h"
+#include "station.h"
+#include "control_pipe.h"
 
 //#define CONTROL_PIPE_MESSAGES
 
-#define CTL_BUFFER_SIZE 100
-
-static FILE *f_ctl;
+static void read_control_pipe(void *arg);
 
 /*
  * Opens a file (pipe) to be used to control the RDS coder, in non-blocking mode.
  */
 
-int open_control_pipe(char *filename) {
-	int fd = open(filename, O_RDONLY | O_NONBLOCK);
-	if (fd == -1) return -1;
+int open_control_pipe(struct control_pipe_t *ctl, char *filename,
+	struct station_t *st) {
+	ctl->station = st;
+	ctl->len = 0;
 
-	int flags;
-	flags = fcntl(fd, F_GETFL, 0) | O_NONBLOCK;
-	if (fcntl(fd, F_SETFL, flags) == -1) return -1;
+	/* Opened for writing too, so the pipe never reports end of file
+	 * after a writer has gone and the event loop isn't woken for it
+	 */
+	ctl->fd = open(filename, O_RDWR | O_NONBLOCK);
+	if (ctl->fd == -1) return -1;
 
-	f_ctl = fdopen(fd, "r");
-	if (f_ctl == NULL) return -1;
+	if (add_event_fd(ctl->fd, read_control_pipe, ctl) < 0) {
+		close(ctl->fd);
+		ctl->fd = -1;
+		return -1;
+	}
 
 	return 0;
 }
 
 
 /*
- * Polls the control file (pipe), non-blockingly, and if a command is received,
- * processes it and updates the RDS data.
+ * Processes a single command and updates the RDS data of a station.
  */
 
-int poll_control_pipe() {
-	static char buf[CTL_BUFFER_SIZE];
+int process_control_command(struct station_t *st, char *res) {
+	struct rds_encoder_t *enc = &st->rds;
 
-	char *res = fgets(buf, CTL_BUFFER_SIZE, f_ctl);
-	if (res == NULL) return -1;
 	if (strlen(res) > 3 && res[2] == ' ') {
 		char *arg = res+3;
 		if (arg[strlen(arg)-1] == '\n') arg[strlen(arg)-1] = 0;
+		if (res[0] == 'A' && res[1] == 'T') {
+			struct timespec now;
+			char *cmd;
+			double time = strtod(arg, &cmd);
+			// "+seconds" is relative to now
+			if (arg[0] == '+') {
+				clock_gettime(CLOCK_REALTIME, &now);
+				time += now.tv_sec + now.tv_nsec / 1e9;
+			}
+			while (*cmd == ' ') cmd++;
+			if (cmd != arg && *cmd && schedule_command(&st->schedule, time, cmd) == 0) {
+#ifdef CONTROL_PIPE_MESSAGES
+				fprintf(stderr, "Scheduled \"%s\" at %.3f\n", cmd, time);
+#endif
+			}
+			return 1;
+		}
 		if (res[0] == 'P' && res[1] == 'I') {
 			arg[4] = 0;
 			uint16_t pi = strtoul(arg, NULL, 16);
-			set_rds_pi(pi);
+			set_rds_pi(enc, pi);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "PI set to: \"%04X\"\n", pi);
 #endif
@@ -71,7 +99,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'P' && res[1] == 'S') {
 			arg[8] = 0;
-			set_rds_ps(arg);
+			set_rds_ps(enc, arg);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "PS set to: \"%s\"\n", arg);
 #endif
@@ -79,7 +107,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'R' && res[1] == 'T') {
 			arg[64] = 0;
-			set_rds_rt(arg);
+			set_rds_rt(enc, arg);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "RT set to: \"%s\"\n", arg);
 #endif
@@ -87,7 +115,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'T' && res[1] == 'A') {
 			uint8_t ta = (arg[0] == 'O' && arg[1] == 'N');
-			set_rds_ta(ta);
+			set_rds_ta(enc, ta);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "Set TA to %s\n", ta ? "ON" : "OFF");
 #endif
@@ -95,7 +123,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'T' && res[1] == 'P') {
 			uint8_t tp = (arg[0] == 'O' && arg[1] == 'N');
-			set_rds_tp(tp);
+			set_rds_tp(enc, tp);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "Set TP to %s\n", tp ? "ON" : "OFF");
 #endif
@@ -103,7 +131,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'M' && res[1] == 'S') {
 			uint8_t ms = (arg[0] == 'O' && arg[1] == 'N');
-			set_rds_ms(ms);
+			set_rds_ms(enc, ms);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "Set MS to %s\n", ms ? "ON" : "OFF");
 #endif
@@ -111,7 +139,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'A' && res[1] == 'B') {
 			uint8_t ab = (arg[0] == 'A');
-			set_rds_ab(ab);
+			set_rds_ab(enc, ab);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "Set AB to %s\n", ab ? "A" : "B");
 #endif
@@ -119,7 +147,7 @@ int poll_control_pipe() {
 		}
 		if (res[0] == 'D' && res[1] == 'I') {
 			uint8_t di = strtoul(arg, NULL, 10);
-			set_rds_di(di);
+			set_rds_di(enc, di);
 #ifdef CONTROL_PIPE_MESSAGES
 			fprintf(stderr, "DI value set to %u\n", di);
 #endif
@@ -130,10 +158,29 @@ int poll_control_pipe() {
 	if (strlen(res) > 4 && res[3] == ' ') {
 		char *arg = res+4;
 		if (arg[strlen(arg)-1] == '\n') arg[strlen(arg)-1] = 0;
+		if (res[0] == 'S' && res[1] == 'E' && res[2] == 'Q') {
+			if (strcmp(arg, "OFF") == 0) {
+				stop_command_sequence(&st->sequencer);
+#ifdef CONTROL_PIPE_MESSAGES
+				fprintf(stderr, "Sequence stopped\n");
+#endif
+			} else {
+				load_command_sequence(&st->sequencer, arg);
+			}
+			return 1;
+		}
+		if (res[0] == 'N' && res[1] == 'O' && res[2] == 'W') {
+			if (schedule_command_now(&st->schedule, arg) == 0) {
+#ifdef CONTROL_PIPE_MESSAGES
+				fprintf(stderr, "Scheduled \"%s\" with the audio\n", arg);
+#endif
+			}
+			return 1;
+		}
 		if (res[0] == 'P' && res[1] == 'T' && res[2] == 'Y') {
 			uint8_t pty = strtoul(arg, NULL, 10);
 			if (pty <= 31) {
-				set_rds_pty(pty);
+				set_rds_pty(enc, pty);
 #ifdef CONTROL_PIPE_MESSAGES
 				if (!pty) {
 					fprintf(stderr, "PTY disabled\n");
@@ -153,7 +200,7 @@ int poll_control_pipe() {
 				fprintf(stderr, "RT+ tag 1: type: %u, start: %u, length: %u\n", tags[0], tags[1], tags[2]);
 				fprintf(stderr, "RT+ tag 2: type: %u, start: %u, length: %u\n", tags[3], tags[4], tags[5]);
 #endif
-				set_rds_rtplus_tags((uint8_t *)tags);
+				set_rds_rtplus_tags(enc, (uint8_t *)tags);
 			}
 #ifdef CONTROL_PIPE_MESSAGES
 			else {
@@ -166,13 +213,21 @@ int poll_control_pipe() {
 			uint8_t gains[5];
 			if (sscanf(arg, "%hhu,%hhu,%hhu,%hhu,%hhu", &gains[0], &gains[1], &gains[2], &gains[3], &gains[4]) == 5) {
 				for (int i = 0; i < 5; i++) {
-					set_carrier_volume(i, gains[i]);
+					set_carrier_volume(&st->mpx, i, gains[i]);
 				}
 			}
 			return 1;
 		}
+		if (res[0] == 'G' && res[1] == 'R' && res[2] == 'P') {
+			if (set_rds_group_rates(enc, arg) == 0) {
+#ifdef CONTROL_PIPE_MESSAGES
+				fprintf(stderr, "Group rates set to: \"%s\"\n", arg);
+#endif
+			}
+			return 1;
+		}
 		if (res[0] == 'V' && res[1] == 'O' && res[2] == 'L') {
-			set_output_volume(strtoul(arg, NULL, 10));
+			set_output_volume(&st->mpx, strtoul(arg, NULL, 10));
 			return 1;
 		}
 	}
@@ -185,7 +240,7 @@ int poll_control_pipe() {
 #ifdef CONTROL_PIPE_MESSAGES
 				fprintf(stderr, "RT+ flags: running: %u, toggle: %u\n", running, toggle);
 #endif
-				set_rds_rtplus_flags(running, toggle);
+				set_rds_rtplus_flags(enc, running, toggle);
 			}
 #ifdef CONTROL_PIPE_MESSAGES
 			else {
@@ -201,23 +256,74 @@ int poll_control_pipe() {
 				fprintf(stderr, "PTYN disabled\n");
 #endif
 				char tmp[8] = {0};
-				set_rds_ptyn(tmp);
+				set_rds_ptyn(enc, tmp);
 			} else {
 #ifdef CONTROL_PIPE_MESSAGES
 				fprintf(stderr, "PTYN set to: \"%s\"\n", arg);
 #endif
-				set_rds_ptyn(arg);
+				set_rds_ptyn(enc, arg);
 			}
 			return 1;
 		}
+#ifdef RDS2
+		if (res[0] == 'L' && res[1] == 'O' && res[2] == 'G' && res[3] == 'O') {
+			if (parse_rds2_logo(arg) == 0) {
+#ifdef CONTROL_PIPE_MESSAGES
+				fprintf(stderr, "Station logo set to: \"%s\"\n", arg);
+#endif
+			}
+			return 1;
+		}
+#endif
+	}
+	if (strlen(res) > 6 && res[5] == ' ') {
+		char *arg = res+6;
+		if (arg[strlen(arg)-1] == '\n') arg[strlen(arg)-1] = 0;
+		if (res[0] == 'S' && res[1] == 'T' && res[2] == 'A' && res[3] == 'T' && res[4] == 'S') {
+			write_stats(st, arg);
+			return 1;
+		}
 	}
 	return -1;
 }
 
-int close_control_pipe() {
-	if (f_ctl) {
-		return fclose(f_ctl);
-	} else {
-		return 0;
+/* Run every complete line that has come in. Called by the event loop
+ * when the pipe is readable.
+ */
+static void read_control_pipe(void *arg) {
+	struct control_pipe_t *ctl = (struct control_pipe_t *)arg;
+	ssize_t bytes;
+	char *line, *end;
+	char next;
+
+	bytes = read(ctl->fd, ctl->buf + ctl->len, CTL_BUFFER_SIZE - 1 - ctl->len);
+	if (bytes <= 0) return;
+	ctl->len += bytes;
+	ctl->buf[ctl->len] = 0;
+
+	line = ctl->buf;
+	while ((end = strchr(line, '\n')) != NULL) {
+		// the commands expect the newline
+		next = end[1];
+		end[1] = 0;
+		process_control_command(ctl->station, line);
+		end[1] = next;
+		line = end + 1;
 	}
+
+	ctl->len -= line - ctl->buf;
+	memmove(ctl->buf, line, ctl->len);
+	// drop lines that don't fit
+	if (ctl->len == CTL_BUFFER_SIZE - 1) ctl->len = 0;
+}
+
+int close_control_pipe(struct control_pipe_t *ctl) {
+	int r;
+
+	if (ctl->fd < 0) return 0;
+
+	remove_event_fd(ctl->fd);
+	r = close(ctl->fd);
+	ctl->fd = -1;
+	return r;
 }
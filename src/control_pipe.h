@@ -16,6 +16,24 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-extern int open_control_pipe(char *filename);
-extern int close_control_pipe();
-extern int poll_control_pipe();
+#ifndef CONTROL_PIPE_H
+#define CONTROL_PIPE_H
+
+#define CTL_BUFFER_SIZE 100
+
+struct station_t;
+
+typedef struct control_pipe_t {
+	int fd;
+	// commands read so far, waiting for the end of the line
+	char buf[CTL_BUFFER_SIZE];
+	size_t len;
+	struct station_t *station;
+} control_pipe_t;
+
+extern int open_control_pipe(struct control_pipe_t *ctl, char *filename,
+	struct station_t *st);
+extern int close_control_pipe(struct control_pipe_t *ctl);
+extern int process_control_command(struct station_t *st, char *res);
+
+#endif /* CONTROL_PIPE_H */
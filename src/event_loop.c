@@ -0,0 +1,218 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include "event_loop.h"
+
+/*
+ * Event loop of the main thread
+ *
+ * Waits on the control pipe, the UECP sockets, timers and the like
+ * instead of polling them, so nothing wakes up while there is nothing
+ * to do. SIGINT and SIGTERM arrive through a signalfd and other threads
+ * stop the loop through an eventfd, which is safe to do from anywhere.
+ */
+
+typedef struct event_source_t {
+	int fd;
+	uint8_t timer;
+	event_handler_t handler;
+	void *arg;
+} event_source_t;
+
+static struct event_source_t sources[MAX_EVENT_SOURCES];
+static int epoll_fd = -1;
+static int signal_fd = -1;
+static int stop_fd = -1;
+static uint8_t running;
+
+static struct event_source_t *add_source(int fd, event_handler_t handler,
+	void *arg) {
+	struct epoll_event event;
+
+	for (uint8_t i = 0; i < MAX_EVENT_SOURCES; i++) {
+		if (sources[i].handler != NULL) continue;
+
+		memset(&event, 0, sizeof(struct epoll_event));
+		event.events = EPOLLIN;
+		event.data.ptr = &sources[i];
+		if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+			fprintf(stderr, "Could not watch file descriptor %d: %s.\n",
+				fd, strerror(errno));
+			return NULL;
+		}
+
+		sources[i].fd = fd;
+		sources[i].timer = 0;
+		sources[i].handler = handler;
+		sources[i].arg = arg;
+		return &sources[i];
+	}
+
+	fprintf(stderr, "Too many event sources.\n");
+	return NULL;
+}
+
+static void handle_signal(void *arg) {
+	struct signalfd_siginfo info;
+	(void)arg;
+
+	if (read(signal_fd, &info, sizeof(info)) == sizeof(info)) running = 0;
+}
+
+static void handle_stop(void *arg) {
+	uint64_t count;
+	(void)arg;
+
+	if (read(stop_fd, &count, sizeof(count)) == sizeof(count)) running = 0;
+}
+
+/* Must be called before any other thread is created, so that all of them
+ * inherit the blocked signals and only the signalfd gets to see them.
+ */
+int8_t init_event_loop() {
+	sigset_t mask;
+
+	for (uint8_t i = 0; i < MAX_EVENT_SOURCES; i++) sources[i].fd = -1;
+
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll_fd < 0) goto error;
+
+	/* a shell starts background jobs with SIGINT ignored, and ignored
+	 * signals never reach the signalfd
+	 */
+	signal(SIGINT, SIG_DFL);
+	signal(SIGTERM, SIG_DFL);
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGINT);
+	sigaddset(&mask, SIGTERM);
+	if (pthread_sigmask(SIG_BLOCK, &mask, NULL) != 0) goto error;
+	signal_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (signal_fd < 0) goto error;
+	if (add_source(signal_fd, handle_signal, NULL) == NULL) goto error;
+
+	stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (stop_fd < 0) goto error;
+	if (add_source(stop_fd, handle_stop, NULL) == NULL) goto error;
+
+	running = 1;
+	return 0;
+
+error:
+	fprintf(stderr, "Could not set up the event loop: %s.\n", strerror(errno));
+	return -1;
+}
+
+/* Call handler whenever fd is readable */
+int8_t add_event_fd(int fd, event_handler_t handler, void *arg) {
+	return add_source(fd, handler, arg) == NULL ? -1 : 0;
+}
+
+void remove_event_fd(int fd) {
+	for (uint8_t i = 0; i < MAX_EVENT_SOURCES; i++) {
+		if (sources[i].handler == NULL || sources[i].fd != fd) continue;
+		epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+		if (sources[i].timer) close(fd);
+		sources[i].fd = -1;
+		sources[i].handler = NULL;
+	}
+}
+
+/* Call handler every interval_ms milliseconds */
+int8_t add_event_timer(uint32_t interval_ms, event_handler_t handler,
+	void *arg) {
+	struct itimerspec spec;
+	struct event_source_t *source;
+	int fd;
+
+	fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (fd < 0) {
+		fprintf(stderr, "Could not create timer: %s.\n", strerror(errno));
+		return -1;
+	}
+
+	spec.it_interval.tv_sec = interval_ms / 1000;
+	spec.it_interval.tv_nsec = (interval_ms % 1000) * 1000000;
+	spec.it_value = spec.it_interval;
+	if (timerfd_settime(fd, 0, &spec, NULL) < 0) {
+		fprintf(stderr, "Could not start timer: %s.\n", strerror(errno));
+		close(fd);
+		return -1;
+	}
+
+	source = add_source(fd, handler, arg);
+	if (source == NULL) {
+		close(fd);
+		return -1;
+	}
+	source->timer = 1;
+
+	return 0;
+}
+
+/* Make run_event_loop return. Safe to call from any thread. */
+void stop_event_loop() {
+	uint64_t one = 1;
+	// can only fail if the counter would overflow
+	ssize_t r = write(stop_fd, &one, sizeof(one));
+
+	(void)r;
+}
+
+/* Run the handlers until a signal or stop_event_loop() says to stop */
+void run_event_loop() {
+	struct epoll_event event;
+	struct event_source_t *source;
+	uint64_t expirations;
+
+	while (running) {
+		/* one event at a time, so a handler may remove or add sources
+		 * without leaving stale events behind
+		 */
+		if (epoll_wait(epoll_fd, &event, 1, -1) < 0) {
+			if (errno == EINTR) continue;
+			fprintf(stderr, "Event loop failed: %s.\n", strerror(errno));
+			break;
+		}
+
+		source = (struct event_source_t *)event.data.ptr;
+		if (source->handler == NULL) continue;
+		if (source->timer &&
+			read(source->fd, &expirations, sizeof(expirations)) < 0)
+			continue;
+		source->handler(source->arg);
+	}
+}
+
+void exit_event_loop() {
+	for (uint8_t i = 0; i < MAX_EVENT_SOURCES; i++) {
+		if (sources[i].handler != NULL && sources[i].timer)
+			close(sources[i].fd);
+		sources[i].handler = NULL;
+	}
+	if (stop_fd >= 0) close(stop_fd);
+	if (signal_fd >= 0) close(signal_fd);
+	if (epoll_fd >= 0) close(epoll_fd);
+}
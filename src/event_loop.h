@@ -0,0 +1,33 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* File descriptors and timers the event loop can wait on at once, with
+ * room for a control pipe per station
+ */
+#define MAX_EVENT_SOURCES	48
+
+typedef void (*event_handler_t)(void *arg);
+
+extern int8_t init_event_loop();
+extern int8_t add_event_fd(int fd, event_handler_t handler, void *arg);
+extern void remove_event_fd(int fd);
+extern int8_t add_event_timer(uint32_t interval_ms, event_handler_t handler,
+	void *arg);
+extern void stop_event_loop();
+extern void run_event_loop();
+extern void exit_event_loop();
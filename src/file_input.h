@@ -16,6 +16,23 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-extern int8_t open_file_input(char *filename, uint32_t *sample_rate, uint8_t wait, size_t num_frames);
-extern int16_t read_file_input(short *audio);
-extern void close_file_input();
+#ifndef FILE_INPUT_H
+#define FILE_INPUT_H
+
+#include <sndfile.h>
+
+typedef struct file_input_t {
+	SNDFILE *inf;
+	uint8_t channels;
+	uint8_t audio_wait;
+	short *buf;
+	size_t target_len;
+	uint8_t silent;
+} file_input_t;
+
+extern int8_t open_file_input(struct file_input_t *in, char *filename,
+	uint32_t *sample_rate, uint8_t wait, size_t num_frames);
+extern int16_t read_file_input(struct file_input_t *in, short *audio);
+extern void close_file_input(struct file_input_t *in);
+
+#endif /* FILE_INPUT_H */
@@ -19,9 +19,8 @@
 #include "common.h"
 #include "file_output.h"
 
-static SNDFILE *inf;
-
-int open_file_output(char *filename, unsigned int sample_rate, unsigned int channels) {
+int open_file_output(struct file_output_t *out, char *filename,
+	unsigned int sample_rate, unsigned int channels) {
         SF_INFO sfinfo;
 	sfinfo.samplerate = sample_rate;
 	sfinfo.channels = channels;
@@ -30,7 +29,7 @@ int open_file_output(char *filename, unsigned int sample_rate, unsigned int chan
 	// stdout or file on the filesystem?
 	if(filename[0] == '-' && filename[1] == 0) {
 		sfinfo.format |= SF_FORMAT_RAW;
-		if(!(inf = sf_open_fd(fileno(stdout), SFM_WRITE, &sfinfo, 0))) {
+		if(!(out->outf = sf_open_fd(fileno(stdout), SFM_WRITE, &sfinfo, 0))) {
 			fprintf(stderr, "Error: could not open stdout for audio output.\n");
 			return -1;
 		} else {
@@ -38,7 +37,7 @@ int open_file_output(char *filename, unsigned int sample_rate, unsigned int chan
 		}
 	} else {
 		sfinfo.format |= SF_FORMAT_WAV;
-		if(!(inf = sf_open(filename, SFM_WRITE, &sfinfo))) {
+		if(!(out->outf = sf_open(filename, SFM_WRITE, &sfinfo))) {
 			fprintf(stderr, "Error: could not open output file %s.\n", filename);
 			return -1;
 		} else {
@@ -49,16 +48,17 @@ int open_file_output(char *filename, unsigned int sample_rate, unsigned int chan
 	return 0;
 }
 
-int write_file_output(short *audio, size_t num_frames) {
+int write_file_output(struct file_output_t *out, short *audio,
+	size_t num_frames) {
 	int audio_len;
 
-	if ((audio_len = sf_writef_short(inf, audio, num_frames)) < 0) {
+	if ((audio_len = sf_writef_short(out->outf, audio, num_frames)) < 0) {
 		return -1;
 	}
 
 	return 1;
 }
 
-void close_file_output() {
-	if (sf_close(inf)) fprintf(stderr, "Error closing audio file\n");
+void close_file_output(struct file_output_t *out) {
+	if (sf_close(out->outf)) fprintf(stderr, "Error closing audio file\n");
 }
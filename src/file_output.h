@@ -16,8 +16,19 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef FILE_OUTPUT_H
+#define FILE_OUTPUT_H
+
 #include <sndfile.h>
 
-extern int open_file_output(char *filename, unsigned int sample_rate, unsigned int channels);
-extern int write_file_output(short *audio, size_t num_frames);
-extern void close_file_output();
+typedef struct file_output_t {
+	SNDFILE *outf;
+} file_output_t;
+
+extern int open_file_output(struct file_output_t *out, char *filename,
+	unsigned int sample_rate, unsigned int channels);
+extern int write_file_output(struct file_output_t *out, short *audio,
+	size_t num_frames);
+extern void close_file_output(struct file_output_t *out);
+
+#endif /* FILE_OUTPUT_H */
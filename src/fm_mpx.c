@@ -25,8 +25,7 @@
 #include "fm_mpx.h"
 #include "mpx_carriers.h"
 #include "ssb.h"
-
-static float mpx_vol;
+#include "arena.h"
 
 // MPX carrier index
 enum mpx_carrier_index {
@@ -55,38 +54,22 @@ static const float carrier_frequencies[] = {
 };
 
 /*
- * filter state
- *
- */
-static struct filter_t fir_low_pass;
-
-/*
- * delay buffers for hilbert transform
+ * DSP tables shared by all MPX generators
  *
+ * The carrier waves and filter coefficients never change once built.
  */
-static struct delay_line_t left_delay;
-static struct delay_line_t right_delay;
+static struct osc_t carrier_tables;
+static struct hilbert_fir_t hilbert_tables;
+// only half of the low-pass filter is stored since it is symmetric
+static float *low_pass_coeffs;
 
-/*
- * Local cscillator object
- * this is where the MPX waveforms are stored
- *
- */
-static struct osc_t mpx_osc;
-
-/*
- * Hilbert transformer object
- *
- */
-static struct hilbert_fir_t ssb_ht;
-
-void set_output_volume(uint8_t vol) {
+void set_output_volume(struct fm_mpx_t *mpx, uint8_t vol) {
 	if (vol > 100) vol = 100;
-	mpx_vol = (vol / 100.0f);
+	mpx->mpx_vol = (vol / 100.0f);
 }
 
 // subcarrier volumes
-static float volumes[] = {
+static const float default_volumes[] = {
 	0.09, // pilot tone: 9% modulation
 	0.09, // RDS: 4.5% modulation
 
@@ -95,38 +78,45 @@ static float volumes[] = {
 	0.09
 };
 
-void set_carrier_volume(uint8_t carrier, uint8_t new_volume) {
+void set_carrier_volume(struct fm_mpx_t *mpx, uint8_t carrier,
+	uint8_t new_volume) {
 	if (carrier > 4) return;
-	if (new_volume >= 15) volumes[carrier] = 0.09f;
-	volumes[carrier] = new_volume / 100.0f;
+	if (new_volume >= 15) mpx->volumes[carrier] = 0.09f;
+	mpx->volumes[carrier] = new_volume / 100.0f;
 }
 
-static void init_fir_filter(struct filter_t *flt, uint32_t sample_rate, uint16_t half_size) {
-
-	memset(flt, 0, sizeof(struct filter_t));
-
-	flt->sample_rate = sample_rate;
-	flt->half_size = half_size;
-	flt->size = 2 * half_size - 1;
-
-	// setup input buffers
-	flt->in[0] = malloc(flt->size * sizeof(float));
-	flt->in[1] = malloc(flt->size * sizeof(float));
-	flt->filter = malloc(flt->half_size * sizeof(float));
+static void init_low_pass_coeffs(uint32_t sample_rate, uint16_t half_size,
+	struct arena_t *arena) {
+	low_pass_coeffs = alloc_from_arena(arena, half_size * sizeof(float));
 
 	// Here we divide this coefficient by two because it will be counted twice
 	// when applying the filter
-	flt->filter[half_size-1] = (float)(2 * 24000 / sample_rate / 2);
+	low_pass_coeffs[half_size-1] = (float)(2 * 24000 / sample_rate / 2);
 
 	// Only store half of the filter since it is symmetric
 	double filter, window;
 	for (int i = 1; i < half_size; i++) {
 		filter = sin(M_2PI * 24000 * i / sample_rate) / (M_PI * i); // sinc
 		window = 0.54 - 0.46 * cos(M_2PI * (double)(half_size + i) / (double)(2 * half_size)); // Hamming window
-		flt->filter[half_size-1-i] = (float)(filter * window);
+		low_pass_coeffs[half_size-1-i] = (float)(filter * window);
 	}
 }
 
+static void init_fir_filter(struct filter_t *flt, uint32_t sample_rate,
+	uint16_t half_size, struct arena_t *arena) {
+
+	memset(flt, 0, sizeof(struct filter_t));
+
+	flt->sample_rate = sample_rate;
+	flt->half_size = half_size;
+	flt->size = 2 * half_size - 1;
+
+	// setup input buffers
+	flt->in[0] = alloc_from_arena(arena, flt->size * sizeof(float));
+	flt->in[1] = alloc_from_arena(arena, flt->size * sizeof(float));
+	flt->filter = low_pass_coeffs;
+}
+
 static inline void fir_filter_add(struct filter_t *flt, float *in_buffer) {
 	flt->in[0][flt->index] = in_buffer[0];
 	flt->in[1][flt->index] = in_buffer[1];
@@ -157,19 +147,13 @@ static inline void fir_filter_get(struct filter_t *flt, float *out) {
 	out[1] = flt->out[1];
 }
 
-static void exit_fir_filter(struct filter_t *flt) {
-	free(flt->in[0]);
-	free(flt->in[1]);
-	free(flt->filter);
-}
-
 /*
  * filter delays needed for SSB
  *
  */
-static void init_delay_line(struct delay_line_t *delay_line, uint32_t sample_rate) {
-	delay_line->buffer = malloc(sample_rate * sizeof(float));
-	memset(delay_line->buffer, 0, sample_rate * sizeof(float));
+static void init_delay_line(struct delay_line_t *delay_line,
+	uint32_t max_delay, struct arena_t *arena) {
+	delay_line->buffer = alloc_from_arena(arena, max_delay * sizeof(float));
 }
 
 static void set_delay_line(struct delay_line_t *delay_line, uint32_t new_delay) {
@@ -182,18 +166,26 @@ static inline float delay_line(struct delay_line_t *delay_line, float in) {
 	return delay_line->buffer[delay_line->idx];
 }
 
-static void exit_delay_line(struct delay_line_t *delay_line) {
-	free(delay_line->buffer);
+/* Build the shared tables, once before any generator is set up */
+void init_mpx_tables(struct arena_t *arena) {
+	init_osc(&carrier_tables, MPX_SAMPLE_RATE, carrier_frequencies, arena);
+	init_hilbert_transformer(&hilbert_tables, 512, arena);
+	init_low_pass_coeffs(MPX_SAMPLE_RATE, 128, arena);
 }
 
-void fm_mpx_init() {
-	init_osc(&mpx_osc, MPX_SAMPLE_RATE, carrier_frequencies);
-	init_hilbert_transformer(&ssb_ht, 512);
-	init_fir_filter(&fir_low_pass, MPX_SAMPLE_RATE, 128);
-	init_delay_line(&left_delay, MPX_SAMPLE_RATE);
-	init_delay_line(&right_delay, MPX_SAMPLE_RATE);
-	set_delay_line(&left_delay, 256 /* half of HT filter size */);
-	set_delay_line(&right_delay, 256 /* half of HT filter size */);
+void fm_mpx_init(struct fm_mpx_t *mpx, struct rds_modulator_t *modulator,
+	struct arena_t *arena) {
+	memset(mpx, 0, sizeof(struct fm_mpx_t));
+	mpx->modulator = modulator;
+	memcpy(mpx->volumes, default_volumes, sizeof(default_volumes));
+
+	share_osc(&mpx->mpx_osc, &carrier_tables, arena);
+	share_hilbert_transformer(&mpx->ssb_ht, &hilbert_tables, arena);
+	init_fir_filter(&mpx->fir_low_pass, MPX_SAMPLE_RATE, 128, arena);
+	init_delay_line(&mpx->left_delay, 256, arena);
+	init_delay_line(&mpx->right_delay, 256, arena);
+	set_delay_line(&mpx->left_delay, 256 /* half of HT filter size */);
+	set_delay_line(&mpx->right_delay, 256 /* half of HT filter size */);
 }
 
 /*
@@ -205,12 +197,12 @@ void fm_mpx_init() {
  *
  * Might be removed in favor of the asymmetric DSB modulator below
  */
-static inline float get_ssb(float in, float in_delayed, float sin, float cos, uint8_t sideband) {
+static inline float get_ssb(struct fm_mpx_t *mpx, float in, float in_delayed, float sin, float cos, uint8_t sideband) {
 	float ht;
 	float inphase, quadrature;
 
 	// perform a 90 degree phase shift of all frequency components
-	ht = get_hilbert(&ssb_ht, in);
+	ht = get_hilbert(&mpx->ssb_ht, in);
 
 	// I/Q components
 	inphase    = in_delayed * cos;
@@ -221,42 +213,34 @@ static inline float get_ssb(float in, float in_delayed, float sin, float cos, ui
 		inphase - quadrature;  // usb
 }
 
-/*
- * Asymmetric DSB configuration
- */
-struct {
-	float lsb_power;
-	float usb_power;
-} asym_dsb_config;
-
 /*
  * Asymmetric DSB modulator
  *
  * LSB/USB range: [-1,1]
  * 0 is symmetric
  */
-static inline float get_asym_dsb(float in, float in_delayed, float sin, float cos) {
+static inline float get_asym_dsb(struct fm_mpx_t *mpx, float in, float in_delayed, float sin, float cos) {
 	float ht;
 	float inphase, quadrature;
 
 	// perform a 90 degree phase shift of all frequency components
-	ht = get_hilbert(&ssb_ht, in);
+	ht = get_hilbert(&mpx->ssb_ht, in);
 
 	// I/Q components
 	inphase    = in_delayed * cos;
 	quadrature = ht * sin;
 
-	return	(inphase + quadrature) * asym_dsb_config.lsb_power + // lsb
-		(inphase - quadrature) * asym_dsb_config.usb_power;  // usb
+	return	(inphase + quadrature) * mpx->lsb_power + // lsb
+		(inphase - quadrature) * mpx->usb_power;  // usb
 }
 
-void set_asym_dsb(float asymmetry) {
-	asym_dsb_config.lsb_power = fabsf(1.0 - asymmetry) / 2.0;
-	asym_dsb_config.usb_power = fabsf(1.0 + asymmetry) / 2.0;
+void set_asym_dsb(struct fm_mpx_t *mpx, float asymmetry) {
+	mpx->lsb_power = fabsf(1.0 - asymmetry) / 2.0;
+	mpx->usb_power = fabsf(1.0 + asymmetry) / 2.0;
 }
 
-void fm_mpx_get_samples(float *in, float *out) {
-	uint16_t j = 0;
+void fm_mpx_get_samples(struct fm_mpx_t *mpx, float *in, float *out, size_t frames) {
+	size_t j = 0;
 
 	float lowpass_filter_in[2];
 	float lowpass_filter_out[2];
@@ -265,24 +249,25 @@ void fm_mpx_get_samples(float *in, float *out) {
 	// delayed versions of the above for SSB filter
 	float out_left_delayed, out_right_delayed;
 	float out_mono_delayed, out_stereo_delayed;
+	struct rds_modulator_t *mod = mpx->modulator;
 
-	for (int i = 0; i < NUM_MPX_FRAMES_IN; i++) {
+	for (size_t i = 0; i < frames; i++) {
 		lowpass_filter_in[0] = in[j+0];
 		lowpass_filter_in[1] = in[j+1];
 
 		// First store the current sample(s) into the FIR filter's ring buffer
-		fir_filter_add(&fir_low_pass, lowpass_filter_in);
+		fir_filter_add(&mpx->fir_low_pass, lowpass_filter_in);
 
 		// Now apply the FIR low-pass filter
-		fir_filter_apply(&fir_low_pass);
+		fir_filter_apply(&mpx->fir_low_pass);
 
-		fir_filter_get(&fir_low_pass, lowpass_filter_out);
+		fir_filter_get(&mpx->fir_low_pass, lowpass_filter_out);
 
 		// L/R signals
 		out_left  = lowpass_filter_out[0];
 		out_right = lowpass_filter_out[1];
-		out_left_delayed  = delay_line(&left_delay, out_left);
-		out_right_delayed = delay_line(&right_delay, out_right);
+		out_left_delayed  = delay_line(&mpx->left_delay, out_left);
+		out_right_delayed = delay_line(&mpx->right_delay, out_right);
 
 		// Create sum and difference signals
 		out_mono   = out_left + out_right;
@@ -296,65 +281,58 @@ void fm_mpx_get_samples(float *in, float *out) {
 		if (1) { // SSB mode
 			// delay mono so it is in sync with stereo
 			out[j] += out_mono_delayed * 0.45 +
-				get_wave(&mpx_osc, CARRIER_19K, 1) * volumes[0];
+				get_wave(&mpx->mpx_osc, CARRIER_19K, 1) * mpx->volumes[0];
 
 			out[j] +=
-				get_ssb(out_stereo,
+				get_ssb(mpx, out_stereo,
 					out_stereo_delayed,
-					get_wave(&mpx_osc, CARRIER_38K, 0),
-					get_wave(&mpx_osc, CARRIER_38K, 1),
+					get_wave(&mpx->mpx_osc, CARRIER_38K, 0),
+					get_wave(&mpx->mpx_osc, CARRIER_38K, 1),
 					0 /* LSB */) * 0.45;
 
 		} else {
 			// audio signals need to be limited to 45% to remain within modulation limits
 			out[j] += out_mono * 0.45 +
-				get_wave(&mpx_osc, CARRIER_19K, 1) * volumes[0] +
-				get_wave(&mpx_osc, CARRIER_38K, 1) * out_stereo * 0.45;
+				get_wave(&mpx->mpx_osc, CARRIER_19K, 1) * mpx->volumes[0] +
+				get_wave(&mpx->mpx_osc, CARRIER_38K, 1) * out_stereo * 0.45;
 		}
 
-		out[j] += get_wave(&mpx_osc, CARRIER_57K, 1) * get_rds_sample(0) * volumes[1];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_57K, 1) * get_rds_sample(mod, 0) * mpx->volumes[1];
 #ifdef RDS2
-		out[j] += get_wave(&mpx_osc, CARRIER_67K, 1) * get_rds_sample(1) * volumes[2];
-		out[j] += get_wave(&mpx_osc, CARRIER_71K, 1) * get_rds_sample(2) * volumes[3];
-		out[j] += get_wave(&mpx_osc, CARRIER_76K, 1) * get_rds_sample(3) * volumes[4];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_67K, 1) * get_rds_sample(mod, 1) * mpx->volumes[2];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_71K, 1) * get_rds_sample(mod, 2) * mpx->volumes[3];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_76K, 1) * get_rds_sample(mod, 3) * mpx->volumes[4];
 #endif
 
-		update_osc_phase(&mpx_osc);
+		update_osc_phase(&mpx->mpx_osc);
 
-		out[j] *= mpx_vol;
+		out[j] *= mpx->mpx_vol;
 		out[j+1] = out[j];
 		j += 2;
 	}
 }
 
-void fm_rds_get_samples(float *out) {
-	uint16_t j = 0;
+void fm_rds_get_samples(struct fm_mpx_t *mpx, float *out, size_t frames) {
+	struct rds_modulator_t *mod = mpx->modulator;
+	size_t j = 0;
 
-	for (int i = 0; i < NUM_MPX_FRAMES_IN; i++) {
+	for (size_t i = 0; i < frames; i++) {
 		out[j] = 0.0f;
 
 		// Pilot tone for calibration
-		out[j] += get_wave(&mpx_osc, CARRIER_19K, 1) * volumes[0];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_19K, 1) * mpx->volumes[0];
 
-		//out[j] += get_wave(&mpx_osc, CARRIER_57K, 1) * get_rds_sample(0) * volumes[1];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_57K, 1) * get_rds_sample(mod, 0) * mpx->volumes[1];
 #ifdef RDS2
-		out[j] += get_wave(&mpx_osc, CARRIER_67K, 1) * get_rds_sample(1) * volumes[2];
-		out[j] += get_wave(&mpx_osc, CARRIER_71K, 1) * get_rds_sample(2) * volumes[3];
-		out[j] += get_wave(&mpx_osc, CARRIER_76K, 1) * get_rds_sample(3) * volumes[4];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_67K, 1) * get_rds_sample(mod, 1) * mpx->volumes[2];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_71K, 1) * get_rds_sample(mod, 2) * mpx->volumes[3];
+		out[j] += get_wave(&mpx->mpx_osc, CARRIER_76K, 1) * get_rds_sample(mod, 3) * mpx->volumes[4];
 #endif
 
-		update_osc_phase(&mpx_osc);
+		update_osc_phase(&mpx->mpx_osc);
 
-		out[j] *= mpx_vol;
+		out[j] *= mpx->mpx_vol;
 		out[j+1] = out[j];
 		j += 2;
 	}
 }
-
-void fm_mpx_exit() {
-	exit_hilbert_transformer(&ssb_ht);
-	exit_osc(&mpx_osc);
-	exit_fir_filter(&fir_low_pass);
-	exit_delay_line(&left_delay);
-	exit_delay_line(&right_delay);
-}
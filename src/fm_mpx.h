@@ -16,17 +16,32 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-// Audio in
-#define NUM_AUDIO_FRAMES_IN	512
-#define NUM_AUDIO_FRAMES_OUT	(NUM_AUDIO_FRAMES_IN * 8)
+#ifndef FM_MPX_H
+#define FM_MPX_H
 
-// MPX
-#define NUM_MPX_FRAMES_IN	NUM_AUDIO_FRAMES_OUT
-#define NUM_MPX_FRAMES_OUT	(NUM_MPX_FRAMES_IN * 2)
+#include "mpx_carriers.h"
+#include "ssb.h"
+#include "rds_modulator.h"
+
+/* Pipeline block sizes
+ *
+ * Blocks are counted in MPX frames. Audio is read in blocks of an eighth
+ * of that and the output is written in blocks of twice that.
+ */
+#define DEFAULT_BLOCK_FRAMES	4096
+#define MIN_BLOCK_FRAMES	64
+#define MAX_BLOCK_FRAMES	16384
+#define AUDIO_BLOCK_FRAMES(frames)	((frames) / 8)
+#define OUTPUT_BLOCK_FRAMES(frames)	((frames) * 2)
 
 // The sample rate at which the MPX generation runs at
 #define MPX_SAMPLE_RATE		190000
 
+/* Arena memory fm_mpx_init takes at most: filter state, delay lines and
+ * carrier phases
+ */
+#define MPX_STATE_MEMORY_SIZE	(16 * 1024)
+
 #define OUTPUT_SAMPLE_RATE	192000
 
 /*
@@ -56,9 +71,37 @@ typedef struct delay_line_t {
 	uint32_t idx;
 } delay_line_t;
 
-extern void fm_mpx_init();
-extern void fm_mpx_get_samples(float *in, float *out);
-extern void fm_rds_get_samples(float *out);
-extern void fm_mpx_exit();
-extern void set_output_volume(uint8_t vol);
-extern void set_carrier_volume(uint8_t carrier, uint8_t new_volume);
+/*
+ * MPX generator
+ *
+ * The filter state and carrier phases of one generator. The carrier
+ * waves and filter coefficients are shared by all of them.
+ */
+typedef struct fm_mpx_t {
+	struct rds_modulator_t *modulator;
+	float mpx_vol;
+	// subcarrier volumes
+	float volumes[5];
+	struct filter_t fir_low_pass;
+	// delay buffers for hilbert transform
+	struct delay_line_t left_delay;
+	struct delay_line_t right_delay;
+	// this is where the phases of the MPX waveforms are kept
+	struct osc_t mpx_osc;
+	struct hilbert_fir_t ssb_ht;
+	// asymmetric DSB configuration
+	float lsb_power;
+	float usb_power;
+} fm_mpx_t;
+
+extern void init_mpx_tables(struct arena_t *arena);
+extern void fm_mpx_init(struct fm_mpx_t *mpx, struct rds_modulator_t *modulator,
+	struct arena_t *arena);
+extern void fm_mpx_get_samples(struct fm_mpx_t *mpx, float *in, float *out,
+	size_t frames);
+extern void fm_rds_get_samples(struct fm_mpx_t *mpx, float *out, size_t frames);
+extern void set_output_volume(struct fm_mpx_t *mpx, uint8_t vol);
+extern void set_carrier_volume(struct fm_mpx_t *mpx, uint8_t carrier,
+	uint8_t new_volume);
+
+#endif /* FM_MPX_H */
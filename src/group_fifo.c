@@ -0,0 +1,159 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "rds.h"
+#include "group_fifo.h"
+
+uint16_t group_fifo_depth(struct group_fifo_t *fifo) {
+	uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+	uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+	return head - tail;
+}
+
+/* Returns 0 if the FIFO is full */
+uint8_t group_fifo_push(struct group_fifo_t *fifo, uint64_t *group) {
+	uint32_t head = fifo->head;
+	uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+
+	if (head - tail == GROUP_FIFO_SIZE) return 0;
+
+	memcpy(fifo->groups[head & (GROUP_FIFO_SIZE - 1)], group,
+		GROUP_WORDS * sizeof(uint64_t));
+	__atomic_store_n(&fifo->head, head + 1, __ATOMIC_RELEASE);
+
+	return 1;
+}
+
+static void wake_producer(struct group_fifo_t *fifo) {
+	__atomic_add_fetch(&fifo->wake_seq, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &fifo->wake_seq, FUTEX_WAKE_PRIVATE, 1,
+		NULL, NULL, 0);
+}
+
+/* Take back the groups the producer asked for in group_fifo_unpush, as
+ * far as they haven't been popped. The producer is waiting for this,
+ * so head can be moved here.
+ */
+static void unpush_groups(struct group_fifo_t *fifo, uint32_t tail) {
+	uint32_t head = fifo->head;
+	uint32_t from = fifo->unpush_from;
+
+	if ((int32_t)(from - tail) < 0) from = tail;
+	if ((int32_t)(head - from) < 0) from = head;
+	fifo->unpushed = head - from;
+	__atomic_store_n(&fifo->head, from, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&fifo->unpush, 0, __ATOMIC_SEQ_CST);
+	wake_producer(fifo);
+}
+
+/* Returns 0 if the FIFO is empty */
+uint8_t group_fifo_pop(struct group_fifo_t *fifo, uint64_t *group) {
+	uint32_t tail = fifo->tail;
+	uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+	uint8_t unpush = __atomic_load_n(&fifo->unpush, __ATOMIC_ACQUIRE);
+	uint32_t wake_level;
+
+	if (head == tail) {
+		if (unpush) unpush_groups(fifo, tail);
+		return 0;
+	}
+
+	memcpy(group, fifo->groups[tail & (GROUP_FIFO_SIZE - 1)],
+		GROUP_WORDS * sizeof(uint64_t));
+	__atomic_store_n(&fifo->tail, tail + 1, __ATOMIC_SEQ_CST);
+
+	// the group just popped goes out as it is, the rest may go
+	if (unpush) {
+		unpush_groups(fifo, tail + 1);
+		return 1;
+	}
+
+	// only wake the producer once it has something worth doing
+	wake_level = __atomic_load_n(&fifo->wake_level, __ATOMIC_SEQ_CST);
+	if (wake_level && head - (tail + 1) < wake_level &&
+		__atomic_exchange_n(&fifo->wake_level, 0, __ATOMIC_SEQ_CST)) {
+		wake_producer(fifo);
+	}
+
+	return 1;
+}
+
+/* Sleep until the consumer has brought the FIFO down to level groups,
+ * or the producer has been poked. Only the producer may call this.
+ * Returns -1 once the FIFO is closed.
+ */
+int8_t group_fifo_wait(struct group_fifo_t *fifo, uint16_t level) {
+	uint32_t seq = __atomic_load_n(&fifo->wake_seq, __ATOMIC_SEQ_CST);
+	uint32_t head = fifo->head;
+	uint32_t tail;
+
+	if (__atomic_load_n(&fifo->closed, __ATOMIC_SEQ_CST)) return -1;
+	if (__atomic_exchange_n(&fifo->poked, 0, __ATOMIC_SEQ_CST)) return 0;
+
+	__atomic_store_n(&fifo->wake_level, level + 1, __ATOMIC_SEQ_CST);
+	tail = __atomic_load_n(&fifo->tail, __ATOMIC_SEQ_CST);
+	// returns right away if the sequence moved on since it was read
+	if (head - tail > level)
+		syscall(SYS_futex, &fifo->wake_seq, FUTEX_WAIT_PRIVATE, seq,
+			NULL, NULL, 0);
+	__atomic_store_n(&fifo->wake_level, 0, __ATOMIC_RELAXED);
+
+	return __atomic_load_n(&fifo->closed, __ATOMIC_SEQ_CST) ? -1 : 0;
+}
+
+/* Wake the producer from group_fifo_wait right away, from any thread */
+void poke_group_fifo(struct group_fifo_t *fifo) {
+	__atomic_store_n(&fifo->poked, 1, __ATOMIC_SEQ_CST);
+	wake_producer(fifo);
+}
+
+/* Take back up to the count newest groups, as far as the consumer
+ * hasn't popped them yet. The consumer does this at its next pop, which this waits for, and the
+ * group it pops then is always kept. Only the producer may call this.
+ * Returns the number of groups taken back, or -1 once the FIFO is
+ * closed.
+ */
+int16_t group_fifo_unpush(struct group_fifo_t *fifo, uint16_t count) {
+	uint32_t head = fifo->head;
+	uint32_t seq;
+
+	if (count > GROUP_FIFO_SIZE) count = GROUP_FIFO_SIZE;
+	fifo->unpush_from = head - count;
+	__atomic_store_n(&fifo->unpush, 1, __ATOMIC_SEQ_CST);
+	for (;;) {
+		seq = __atomic_load_n(&fifo->wake_seq, __ATOMIC_SEQ_CST);
+		if (!__atomic_load_n(&fifo->unpush, __ATOMIC_SEQ_CST)) break;
+		if (__atomic_load_n(&fifo->closed, __ATOMIC_SEQ_CST)) return -1;
+		syscall(SYS_futex, &fifo->wake_seq, FUTEX_WAIT_PRIVATE, seq,
+			NULL, NULL, 0);
+	}
+
+	return fifo->unpushed;
+}
+
+/* Wake the producer for good */
+void close_group_fifo(struct group_fifo_t *fifo) {
+	__atomic_store_n(&fifo->closed, 1, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&fifo->wake_seq, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &fifo->wake_seq, FUTEX_WAKE_PRIVATE, INT_MAX,
+		NULL, NULL, 0);
+}
@@ -0,0 +1,57 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GROUP_FIFO_H
+#define GROUP_FIFO_H
+
+/* Must be a power of 2 */
+#define GROUP_FIFO_SIZE		16
+
+/*
+ * Lock-free FIFO of encoded groups
+ *
+ * Safe for one producer and one consumer thread
+ */
+typedef struct group_fifo_t {
+	uint64_t groups[GROUP_FIFO_SIZE][GROUP_WORDS];
+	// only written by the producer
+	uint32_t head __attribute__((aligned(CACHE_LINE_SIZE)));
+	// only written by the consumer
+	uint32_t tail __attribute__((aligned(CACHE_LINE_SIZE)));
+	// fill level a sleeping producer wants to be woken at, plus one
+	uint32_t wake_level __attribute__((aligned(CACHE_LINE_SIZE)));
+	// bumped to wake the producer, which sleeps on it
+	uint32_t wake_seq;
+	// the producer has been woken for something else to do
+	uint8_t poked;
+	uint8_t closed;
+	// groups the producer wants taken back, see group_fifo_unpush
+	uint8_t unpush;
+	uint32_t unpush_from;
+	uint16_t unpushed;
+} group_fifo_t;
+
+extern uint16_t group_fifo_depth(struct group_fifo_t *fifo);
+extern uint8_t group_fifo_push(struct group_fifo_t *fifo, uint64_t *group);
+extern uint8_t group_fifo_pop(struct group_fifo_t *fifo, uint64_t *group);
+extern int8_t group_fifo_wait(struct group_fifo_t *fifo, uint16_t level);
+extern void poke_group_fifo(struct group_fifo_t *fifo);
+extern int16_t group_fifo_unpush(struct group_fifo_t *fifo, uint16_t count);
+extern void close_group_fifo(struct group_fifo_t *fifo);
+
+#endif /* GROUP_FIFO_H */
@@ -0,0 +1,294 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include "rds.h"
+#include "rds_lib.h"
+#include "group_output.h"
+#include "group_input.h"
+
+/*
+ * Group input
+ *
+ * Reads groups built elsewhere, in the same formats the group output
+ * writes, from a file, pipe or a TCP connection ("tcp:PORT"). The
+ * checkwords are always recalculated.
+ *
+ * Nothing here blocks the main thread: pipes are opened without waiting
+ * for a writer and connections are accepted on the input thread, which
+ * waits in poll() for the sender. stop_group_input() wakes it up from
+ * there to shut down.
+ */
+static char input_path[64];
+static uint8_t input_format;
+static int listen_fd = -1;
+static int input_fd = -1;
+static int stop_fd = -1;
+
+// read but not parsed yet
+static char input_buf[256];
+static size_t input_len;
+static size_t input_pos;
+
+/* Wait until fd can be read (or has hung up)
+ * Returns -1 on error or once the input has been stopped
+ */
+static int8_t wait_readable(int fd) {
+	struct pollfd pfd[2];
+
+	pfd[0].fd = fd;
+	pfd[0].events = POLLIN;
+	pfd[1].fd = stop_fd;
+	pfd[1].events = POLLIN;
+	while (poll(pfd, 2, -1) < 0) {
+		if (errno != EINTR) return -1;
+	}
+
+	return pfd[1].revents ? -1 : 0;
+}
+
+static uint8_t stopped() {
+	struct pollfd pfd;
+
+	pfd.fd = stop_fd;
+	pfd.events = POLLIN;
+	return poll(&pfd, 1, 0) > 0;
+}
+
+static int8_t open_source() {
+	if (listen_fd >= 0) {
+		fprintf(stderr, "Waiting for group input connection.\n");
+		if (wait_readable(listen_fd) < 0) return -1;
+		if ((input_fd = accept(listen_fd, NULL, NULL)) < 0) {
+			fprintf(stderr, "Error: could not accept group input connection.\n");
+			return -1;
+		}
+	} else if (input_path[0] == '-' && input_path[1] == 0) {
+		input_fd = STDIN_FILENO;
+	} else {
+		// doesn't wait for a writer if it is a named pipe
+		input_fd = open(input_path, O_RDONLY | O_NONBLOCK);
+	}
+
+	if (input_fd < 0) {
+		fprintf(stderr, "Error: could not open group input %s.\n", input_path);
+		return -1;
+	}
+
+	input_len = input_pos = 0;
+	return 0;
+}
+
+int8_t open_group_input(char *source, uint8_t format) {
+	struct sockaddr_in addr;
+	int on = 1;
+
+	strncpy(input_path, source, 63);
+	input_format = format;
+
+	stop_fd = eventfd(0, EFD_CLOEXEC);
+	if (stop_fd < 0) {
+		fprintf(stderr, "Error: could not set up the group input.\n");
+		return -1;
+	}
+
+	if (strncmp(source, "tcp:", 4) == 0) {
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_ANY);
+		addr.sin_port = htons(strtoul(source + 4, NULL, 10));
+
+		listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (listen_fd < 0 ||
+			setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) < 0 ||
+			bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+			listen(listen_fd, 1) < 0) {
+			fprintf(stderr, "Error: could not listen on %s.\n", source);
+			if (listen_fd >= 0) close(listen_fd);
+			listen_fd = -1;
+			close_group_input();
+			return -1;
+		}
+		fprintf(stderr, "Listening for groups on port %s.\n", source + 4);
+		return 0;
+	}
+
+	if (open_source() < 0) {
+		close_group_input();
+		return -1;
+	}
+	fprintf(stderr, "Reading groups from %s.\n", source);
+
+	return 0;
+}
+
+/* Reopen the source once the sender has gone away
+ * Returns 0 if there is nothing more to read
+ */
+static int8_t reopen_source() {
+	struct stat st;
+	uint8_t is_fifo;
+
+	is_fifo = fstat(input_fd, &st) == 0 && S_ISFIFO(st.st_mode);
+	if (input_fd != STDIN_FILENO) close(input_fd);
+	input_fd = -1;
+
+	// a named pipe can be opened again by the next writer
+	if (listen_fd >= 0 || (is_fifo && input_path[0] != '-')) {
+		return open_source() == 0 ? 1 : -1;
+	}
+
+	return 0;
+}
+
+/* Read more of the input, keeping what hasn't been parsed yet
+ * Returns 0 once the sender has gone away and -1 on error
+ */
+static int8_t read_source() {
+	ssize_t r;
+
+	memmove(input_buf, input_buf + input_pos, input_len - input_pos);
+	input_len -= input_pos;
+	input_pos = 0;
+
+	for (;;) {
+		if (wait_readable(input_fd) < 0) return -1;
+		r = read(input_fd, input_buf + input_len,
+			sizeof(input_buf) - input_len);
+		if (r > 0) {
+			input_len += r;
+			return 1;
+		}
+		// a dropped connection ends the input like a closed pipe
+		if (r == 0 || (errno != EAGAIN && errno != EINTR))
+			return stopped() ? -1 : 0;
+	}
+}
+
+/* Get the next line without its newline. A last line without one
+ * counts too, lines that don't fit are cut off.
+ */
+static int8_t get_line(char *line, size_t size) {
+	char *end;
+	size_t len;
+	int8_t r;
+
+	for (;;) {
+		end = memchr(input_buf + input_pos, '\n', input_len - input_pos);
+		if (end == NULL && input_len - input_pos == sizeof(input_buf))
+			end = input_buf + input_len;
+		if (end != NULL) break;
+
+		if ((r = read_source()) < 0) return r;
+		if (r == 0) {
+			if (input_pos == input_len) return 0;
+			end = input_buf + input_len;
+			break;
+		}
+	}
+
+	len = end - (input_buf + input_pos);
+	if (len > size - 1) len = size - 1;
+	memcpy(line, input_buf + input_pos, len);
+	line[len] = 0;
+	input_pos = end - input_buf;
+	if (input_pos < input_len) input_pos++;
+
+	return 1;
+}
+
+static int8_t get_record(uint8_t *record, size_t size) {
+	int8_t r;
+
+	while (input_len - input_pos < size) {
+		if ((r = read_source()) <= 0) return r;
+	}
+	memcpy(record, input_buf + input_pos, size);
+	input_pos += size;
+
+	return 1;
+}
+
+/* Returns 1 if a group was read, 0 at the end of the source and -1 on
+ * error
+ */
+static int8_t parse_group(uint64_t *bits) {
+	char line[64];
+	uint8_t packed[13];
+	uint16_t blocks[GROUP_LENGTH];
+	int8_t r;
+
+	if (input_format == GROUP_FORMAT_BIN) {
+		if ((r = get_record(packed, sizeof(packed))) <= 0) return r;
+		bits[0] = bits[1] = 0;
+		for (uint8_t i = 0; i < 8; i++) bits[0] |= (uint64_t)packed[i] << (56 - i * 8);
+		for (uint8_t i = 0; i < 5; i++) bits[1] |= (uint64_t)packed[8 + i] << (56 - i * 8);
+		get_group_blocks(bits, blocks);
+		add_checkwords(blocks, bits);
+		return 1;
+	}
+
+	while ((r = get_line(line, sizeof(line))) > 0) {
+		// lines with missing blocks are skipped
+		if (sscanf(line, "%4hx %4hx %4hx %4hx", &blocks[0], &blocks[1],
+			&blocks[2], &blocks[3]) != 4) continue;
+		add_checkwords(blocks, bits);
+		return 1;
+	}
+
+	return r;
+}
+
+/* Wait for the next group
+ * Returns 1 on success, 0 at the end of the input and -1 on error
+ */
+int8_t read_group_input(uint64_t *bits) {
+	int8_t r;
+
+	// wait for the first connection
+	if (input_fd < 0 && open_source() < 0) return -1;
+
+	while ((r = parse_group(bits)) == 0) {
+		if ((r = reopen_source()) <= 0) return r;
+	}
+
+	return r;
+}
+
+/* Make read_group_input give up, from any thread */
+void stop_group_input() {
+	uint64_t one = 1;
+
+	if (stop_fd >= 0 && write(stop_fd, &one, sizeof(one)) < 0)
+		fprintf(stderr, "Could not stop the group input.\n");
+}
+
+/* Only once the input thread has stopped */
+void close_group_input() {
+	if (input_fd >= 0 && input_fd != STDIN_FILENO) close(input_fd);
+	if (listen_fd >= 0) close(listen_fd);
+	if (stop_fd >= 0) close(stop_fd);
+	input_fd = listen_fd = stop_fd = -1;
+}
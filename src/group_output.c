@@ -0,0 +1,100 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <time.h>
+#include "rds.h"
+#include "rds_lib.h"
+#include "group_output.h"
+
+/*
+ * Group output
+ *
+ * Writes the encoded groups of the basic stream instead of modulating
+ * them, either as fast as possible or paced at the RDS group rate
+ * (11.4 groups/s).
+ */
+#define GROUP_PERIOD_NS	(1000000000ULL * BITS_PER_GROUP * SAMPLES_PER_BIT / RDS_SAMPLE_RATE)
+
+static struct rds_encoder_t *enc;
+static FILE *group_file;
+static uint8_t group_format;
+static uint8_t group_pace;
+static struct timespec next_group;
+
+int8_t open_group_output(struct rds_encoder_t *encoder, char *filename,
+	uint8_t format, uint8_t pace) {
+	enc = encoder;
+
+	// stdout or file on the filesystem?
+	if (filename[0] == '-' && filename[1] == 0) {
+		group_file = stdout;
+		fprintf(stderr, "Using stdout for group output.\n");
+	} else {
+		if (!(group_file = fopen(filename, "wb"))) {
+			fprintf(stderr, "Error: could not open group output file %s.\n", filename);
+			return -1;
+		}
+		fprintf(stderr, "Using group output file: %s\n", filename);
+	}
+
+	group_format = format;
+	group_pace = pace;
+	clock_gettime(CLOCK_MONOTONIC, &next_group);
+
+	return 0;
+}
+
+int8_t write_group_output() {
+	uint64_t bits[GROUP_WORDS];
+	uint16_t blocks[GROUP_LENGTH];
+	uint8_t packed[13];
+	int r;
+
+	if (group_pace) {
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_group, NULL);
+		next_group.tv_nsec += GROUP_PERIOD_NS;
+		if (next_group.tv_nsec >= 1000000000) {
+			next_group.tv_nsec -= 1000000000;
+			next_group.tv_sec++;
+		}
+		// keeps the clock time in step with the wall clock
+		add_rds_group_sent(enc);
+	}
+
+	get_rds_bits(enc, bits);
+
+	if (group_format == GROUP_FORMAT_BIN) {
+		for (uint8_t i = 0; i < 8; i++) packed[i] = bits[0] >> (56 - i * 8);
+		for (uint8_t i = 0; i < 5; i++) packed[8 + i] = bits[1] >> (56 - i * 8);
+		r = fwrite(packed, sizeof(packed), 1, group_file) == 1 ? 0 : -1;
+	} else {
+		get_group_blocks(bits, blocks);
+		r = fprintf(group_file, "%04X %04X %04X %04X\n",
+			blocks[0], blocks[1], blocks[2], blocks[3]) < 0 ? -1 : 0;
+	}
+
+	if (group_pace) fflush(group_file);
+
+	return r;
+}
+
+void close_group_output() {
+	if (group_file != stdout) fclose(group_file);
+	else fflush(stdout);
+}
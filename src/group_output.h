@@ -0,0 +1,27 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+enum group_output_formats {
+	GROUP_FORMAT_HEX,	// "PI B C D" in hex, one group per line
+	GROUP_FORMAT_BIN	// 13 bytes per group including checkwords
+};
+
+extern int8_t open_group_output(struct rds_encoder_t *encoder, char *filename,
+	uint8_t format, uint8_t pace);
+extern int8_t write_group_output();
+extern void close_group_output();
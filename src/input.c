@@ -19,9 +19,7 @@
 #include "common.h"
 #include "input.h"
 
-static uint8_t input_type;
-
-int8_t open_input(char *input_name, uint8_t wait, uint32_t *sample_rate, size_t num_frames) {
+int8_t open_input(struct input_t *in, char *input_name, uint8_t wait, uint32_t *sample_rate, size_t num_frames) {
 	// TODO: better detect live capture cards
 	if (input_name[0] == 'p' && input_name[1] == 'u' &&
 	    input_name[2] == 'l' && input_name[3] == 's' &&
@@ -32,12 +30,12 @@ int8_t open_input(char *input_name, uint8_t wait, uint32_t *sample_rate, size_t
 			fprintf(stderr, "Could not open pulse source.\n");
 			return 0;
 		}
-		input_type = 2;
+		in->type = 2;
 	} else {
-		if (open_file_input(input_name, sample_rate, wait, num_frames) < 0) {
+		if (open_file_input(&in->file, input_name, sample_rate, wait, num_frames) < 0) {
 			return 0;
 		}
-		input_type = 1;
+		in->type = 1;
 	}
 
 	if (*sample_rate < 16000) {
@@ -48,21 +46,21 @@ int8_t open_input(char *input_name, uint8_t wait, uint32_t *sample_rate, size_t
 	return 1;
 }
 
-int8_t read_input(short *audio) {
-	if (input_type == 1) {
-		if (read_file_input(audio) < 0) return -1;
+int8_t read_input(struct input_t *in, short *audio) {
+	if (in->type == 1) {
+		if (read_file_input(&in->file, audio) < 0) return -1;
 	}
-	if (input_type == 2) {
+	if (in->type == 2) {
 		if (read_pulse_input(audio) < 0) return -1;
 	}
 	return 0;
 }
 
-void close_input() {
-	if (input_type == 1) {
-		close_file_input();
+void close_input(struct input_t *in) {
+	if (in->type == 1) {
+		close_file_input(&in->file);
 	}
-	if (input_type == 2) {
+	if (in->type == 2) {
 		close_pulse_input();
 	}
 }
@@ -16,9 +16,20 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef INPUT_H
+#define INPUT_H
+
 #include "file_input.h"
 #include "pulse_input.h"
 
-int8_t open_input(char *input_name, uint8_t wait, uint32_t *sample_rate, size_t num_frames);
-int8_t read_input(short *audio);
-void close_input();
+// there is only one pulse input per process
+typedef struct input_t {
+	uint8_t type;
+	struct file_input_t file;
+} input_t;
+
+int8_t open_input(struct input_t *in, char *input_name, uint8_t wait, uint32_t *sample_rate, size_t num_frames);
+int8_t read_input(struct input_t *in, short *audio);
+void close_input(struct input_t *in);
+
+#endif /* INPUT_H */
@@ -0,0 +1,192 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <pthread.h>
+
+#include "rds.h"
+#include "rds_lib.h"
+#include "rds_modulator.h"
+#include "fm_mpx.h"
+#include "arena.h"
+#include "mpxgen.h"
+
+/*
+ * Library interface
+ *
+ * An instance is an encoder, a modulator and an MPX generator, carved out
+ * of an arena of its own when it is created. Only the basic RDS stream
+ * is modulated. The DSP tables are built when the first instance is
+ * created and shared by all of them.
+ */
+struct mpxgen_t {
+	struct arena_t arena;
+	uint8_t mode;
+	struct rds_encoder_t rds;
+	struct rds_modulator_t modulator;
+	struct fm_mpx_t mpx;
+};
+
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+static struct arena_t tables;
+static uint8_t tables_built;
+
+static void build_tables() {
+	if (open_arena(&tables, DSP_MEMORY_SIZE, 0) < 0) return;
+	init_checkword_tables();
+	init_symbol_waveforms(&tables);
+	init_mpx_tables(&tables);
+	tables_built = 1;
+}
+
+mpxgen_t *mpxgen_create(uint8_t mode) {
+	struct arena_t arena;
+	struct mpxgen_t *gen;
+
+	if (mode > MPXGEN_RDS_ONLY) return NULL;
+
+	pthread_once(&tables_once, build_tables);
+	if (!tables_built) return NULL;
+
+	if (open_arena(&arena, sizeof(struct mpxgen_t) + ARENA_ALIGN +
+		MPX_STATE_MEMORY_SIZE, 0) < 0) return NULL;
+	gen = alloc_from_arena(&arena, sizeof(struct mpxgen_t));
+	// the instance keeps the arena it lives in
+	memcpy(&gen->arena, &arena, sizeof(struct arena_t));
+	gen->mode = mode;
+
+	init_rds_encoder(&gen->rds);
+	init_rds_modulator(&gen->modulator, &gen->rds, 1);
+	fm_mpx_init(&gen->mpx, &gen->modulator, &gen->arena);
+	set_output_volume(&gen->mpx, 50);
+
+	begin_rds_update(&gen->rds);
+	set_rds_pi(&gen->rds, 0x1000);
+	set_rds_ps(&gen->rds, "Mpxgen");
+	end_rds_update(&gen->rds);
+
+	return gen;
+}
+
+void mpxgen_destroy(mpxgen_t *gen) {
+	struct arena_t arena;
+
+	if (gen == NULL) return;
+	pthread_mutex_destroy(&gen->rds.update_mutex);
+	pthread_mutex_destroy(&gen->rds.stats_mutex);
+	memcpy(&arena, &gen->arena, sizeof(struct arena_t));
+	close_arena(&arena);
+}
+
+void mpxgen_begin_update(mpxgen_t *gen) {
+	begin_rds_update(&gen->rds);
+}
+
+void mpxgen_end_update(mpxgen_t *gen) {
+	end_rds_update(&gen->rds);
+}
+
+void mpxgen_set_pi(mpxgen_t *gen, uint16_t pi) {
+	set_rds_pi(&gen->rds, pi);
+}
+
+void mpxgen_set_ps(mpxgen_t *gen, const char *ps) {
+	char tmp[PS_LENGTH + 1] = {0};
+
+	strncpy(tmp, ps, PS_LENGTH);
+	set_rds_ps(&gen->rds, tmp);
+}
+
+void mpxgen_set_rt(mpxgen_t *gen, const char *rt) {
+	char tmp[RT_LENGTH + 1] = {0};
+
+	strncpy(tmp, rt, RT_LENGTH);
+	set_rds_rt(&gen->rds, tmp);
+}
+
+void mpxgen_set_pty(mpxgen_t *gen, uint8_t pty) {
+	if (pty > 31) return;
+	set_rds_pty(&gen->rds, pty);
+}
+
+// an empty name turns PTYN off
+void mpxgen_set_ptyn(mpxgen_t *gen, const char *ptyn) {
+	char tmp[PTYN_LENGTH + 1] = {0};
+
+	strncpy(tmp, ptyn, PTYN_LENGTH);
+	set_rds_ptyn(&gen->rds, tmp);
+}
+
+void mpxgen_set_ta(mpxgen_t *gen, uint8_t ta) {
+	set_rds_ta(&gen->rds, ta ? 1 : 0);
+}
+
+void mpxgen_set_tp(mpxgen_t *gen, uint8_t tp) {
+	set_rds_tp(&gen->rds, tp ? 1 : 0);
+}
+
+void mpxgen_set_ms(mpxgen_t *gen, uint8_t ms) {
+	set_rds_ms(&gen->rds, ms ? 1 : 0);
+}
+
+/* Replace the AF list with frequencies in MHz (FM) or kHz (LF/MF).
+ * Returns -1 and keeps the old list if one of them can't be sent.
+ */
+int8_t mpxgen_set_af(mpxgen_t *gen, const float *freqs, uint8_t num) {
+	struct rds_af_t af_list;
+
+	memset(&af_list, 0, sizeof(struct rds_af_t));
+	for (uint8_t i = 0; i < num; i++) {
+		if (add_rds_af(&af_list, freqs[i]) < 0) return -1;
+	}
+	set_rds_af(&gen->rds, af_list);
+
+	return 0;
+}
+
+// same format as --group-rates
+int8_t mpxgen_set_group_rates(mpxgen_t *gen, const char *rates) {
+	char tmp[128] = {0};
+
+	strncpy(tmp, rates, sizeof(tmp) - 1);
+	return set_rds_group_rates(&gen->rds, tmp);
+}
+
+void mpxgen_set_volume(mpxgen_t *gen, uint8_t volume) {
+	set_output_volume(&gen->mpx, volume);
+}
+
+/* Seconds the rendered signal takes to get on air, which the clock time
+ * is sent ahead by
+ */
+void mpxgen_set_latency(mpxgen_t *gen, float latency) {
+	set_rds_ct_latency(&gen->rds, latency);
+}
+
+/* Render frames of MPX into out, which holds frames * 2 floats. In
+ * composite mode in holds as many frames of stereo audio, in RDS-only
+ * mode it isn't used and may be NULL.
+ */
+void mpxgen_render(mpxgen_t *gen, const float *in, float *out,
+	size_t frames) {
+	if (gen->mode == MPXGEN_RDS_ONLY || in == NULL) {
+		fm_rds_get_samples(&gen->mpx, out, frames);
+	} else {
+		fm_mpx_get_samples(&gen->mpx, (float *)in, out, frames);
+	}
+}
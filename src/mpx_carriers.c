@@ -17,6 +17,7 @@
  */
 
 #include "common.h"
+#include "arena.h"
 #include "mpx_carriers.h"
 
 /*
@@ -26,16 +27,34 @@
  *
  */
 
+/*
+ * Number of samples in one cycle of a given frequency, as far as the
+ * lookup tables are concerned
+ */
+static uint16_t get_wave_period(uint32_t rate, float freq) {
+	// used to determine if we have completed a cycle
+	uint8_t zero_crossings = 0;
+	uint16_t i;
+	double w = M_2PI * freq;
+	float sin_sample;
+
+	for (i = 1; i < rate; i++) {
+		sin_sample = sin(w * (i / (double)rate));
+		if (sin_sample > -0.1e-4 && sin_sample < 0.1e-4) {
+			if (++zero_crossings == 2) break;
+		}
+	}
+
+	return i;
+}
+
 /*
  * DDS function generator
  *
  * Create wave constants for a given frequency
  */
-static void create_wave(uint32_t rate, float freq, float *sin_wave, float *cos_wave, uint16_t *max_phase) {
+static void create_wave(uint32_t rate, float freq, float *sin_wave, float *cos_wave, uint16_t max_phase) {
 	float sin_sample, cos_sample;
-	// used to determine if we have completed a cycle
-	uint8_t zero_crossings = 0;
-	uint16_t i;
 	double w = M_2PI * freq;
 	double phase;
 
@@ -43,27 +62,25 @@ static void create_wave(uint32_t rate, float freq, float *sin_wave, float *cos_w
 	*sin_wave++ = 0.0f;
 	*cos_wave++ = 1.0f;
 
-	for (i = 1; i < rate; i++) {
+	for (uint16_t i = 1; i < max_phase; i++) {
 		phase = i / (double)rate;
 		sin_sample = sin(w * phase);
 		cos_sample = cos(w * phase);
 		if (sin_sample > -0.1e-4 && sin_sample < 0.1e-4) {
-			if (++zero_crossings == 2) break;
 			*sin_wave++ = 0.0f;
 		} else {
 			*sin_wave++ = sin_sample;
 		}
 		*cos_wave++ = cos_sample;
 	}
-
-	*max_phase = i;
 }
 
 /*
  * Create waveform lookup tables for frequencies in the array
  *
  */
-void init_osc(struct osc_t *osc_ctx, uint32_t sample_rate, const float *c_freqs) {
+void init_osc(struct osc_t *osc_ctx, uint32_t sample_rate, const float *c_freqs,
+	struct arena_t *arena) {
 	uint8_t num_freqs = 0;
 	// look for the 0 terminator
 	for (;;) {
@@ -79,30 +96,54 @@ void init_osc(struct osc_t *osc_ctx, uint32_t sample_rate, const float *c_freqs)
 	 * first index is wave frequency
 	 * second index is wave data
 	 */
-	osc_ctx->sine_waves = malloc(num_freqs * sizeof(float));
-	osc_ctx->cosine_waves = malloc(num_freqs * sizeof(float));
+	osc_ctx->sine_waves = alloc_from_arena(arena, num_freqs * sizeof(float *));
+	osc_ctx->cosine_waves = alloc_from_arena(arena, num_freqs * sizeof(float *));
 	/*
 	 * phase table
 	 *
 	 * current and max
 	 */
-	osc_ctx->phases = malloc(num_freqs * 2 * sizeof(uint16_t));
+	osc_ctx->phases = alloc_from_arena(arena, num_freqs * sizeof(uint16_t *));
 
 	for (uint8_t i = 0; i < num_freqs; i++) {
-		osc_ctx->sine_waves[i] = malloc(sample_rate * sizeof(float));
-		osc_ctx->cosine_waves[i] = malloc(sample_rate * sizeof(float));
-		osc_ctx->phases[i] = malloc(2 * sizeof(uint16_t));
+		osc_ctx->phases[i] = alloc_from_arena(arena, 2 * sizeof(uint16_t));
 		osc_ctx->phases[i][CURRENT] = 0;
+		// only one cycle is stored
+		osc_ctx->phases[i][MAX] = get_wave_period(sample_rate, c_freqs[i]);
+		osc_ctx->sine_waves[i] =
+			alloc_from_arena(arena, osc_ctx->phases[i][MAX] * sizeof(float));
+		osc_ctx->cosine_waves[i] =
+			alloc_from_arena(arena, osc_ctx->phases[i][MAX] * sizeof(float));
 
 		// create waveform data and load into lookup tables
 		create_wave(sample_rate, c_freqs[i],
 			osc_ctx->sine_waves[i],
 			osc_ctx->cosine_waves[i],
-			&osc_ctx->phases[i][MAX]
+			osc_ctx->phases[i][MAX]
 		);
 	}
 }
 
+/*
+ * Set up an oscillator on the lookup tables of another one
+ *
+ * Only the phases are its own, the tables are never written to.
+ */
+void share_osc(struct osc_t *osc_ctx, const struct osc_t *tables,
+	struct arena_t *arena) {
+	osc_ctx->num_freqs = tables->num_freqs;
+	osc_ctx->sine_waves = tables->sine_waves;
+	osc_ctx->cosine_waves = tables->cosine_waves;
+	osc_ctx->phases = alloc_from_arena(arena,
+		osc_ctx->num_freqs * sizeof(uint16_t *));
+
+	for (uint8_t i = 0; i < osc_ctx->num_freqs; i++) {
+		osc_ctx->phases[i] = alloc_from_arena(arena, 2 * sizeof(uint16_t));
+		osc_ctx->phases[i][CURRENT] = 0;
+		osc_ctx->phases[i][MAX] = tables->phases[i][MAX];
+	}
+}
+
 /*
  * Get a waveform sample for a given frequency
  *
@@ -128,18 +169,3 @@ void update_osc_phase(struct osc_t *osc_ctx) {
 			osc_ctx->phases[i][CURRENT] = 0;
 	}
 }
-
-/*
- * Unload all waveform and phase tables
- *
- */
-void exit_osc(struct osc_t *osc_ctx) {
-	for (uint8_t i = 0; i < osc_ctx->num_freqs; i++) {
-		free(osc_ctx->sine_waves[i]);
-		free(osc_ctx->cosine_waves[i]);
-		free(osc_ctx->phases[i]);
-	}
-	free(osc_ctx->sine_waves);
-	free(osc_ctx->cosine_waves);
-	free(osc_ctx->phases);
-}
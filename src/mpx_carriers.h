@@ -16,6 +16,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef MPX_CARRIERS_H
+#define MPX_CARRIERS_H
+
+#include "arena.h"
+
 // context for MPX oscillator
 typedef struct osc_t {
 	/*
@@ -44,7 +49,11 @@ enum osc_phase_index {
 	MAX
 };
 
-extern void init_osc(struct osc_t *osc_ctx, uint32_t sample_rate, const float *c_freqs);
+extern void init_osc(struct osc_t *osc_ctx, uint32_t sample_rate,
+	const float *c_freqs, struct arena_t *arena);
+extern void share_osc(struct osc_t *osc_ctx, const struct osc_t *tables,
+	struct arena_t *arena);
 extern float get_wave(struct osc_t *osc_ctx, uint8_t num, uint8_t cosine);
 extern void update_osc_phase(struct osc_t *osc_ctx);
-extern void exit_osc(struct osc_t *osc_ctx);
+
+#endif /* MPX_CARRIERS_H */
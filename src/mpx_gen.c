@@ -17,276 +17,314 @@
  */
 
 #include "common.h"
-#include <signal.h>
 #include <getopt.h>
 #include <pthread.h>
+#include <limits.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 
 #include "rds.h"
+#ifdef RDS2
+#include "rds2.h"
+#endif
 #include "fm_mpx.h"
+#include "rds_modulator.h"
 #include "control_pipe.h"
 #include "audio_conversion.h"
 #include "resampler.h"
 #include "input.h"
 #include "output.h"
-
-// buffers
-static float *audio_in_buffer;
-static float *resampled_audio_in_buffer;
-static float *mpx_buffer;
-static float *out_buffer;
+#include "group_output.h"
+#include "group_input.h"
+#include "uecp.h"
+#include "schedule.h"
+#include "sequencer.h"
+#include "stats.h"
+#include "block_ring.h"
+#include "realtime.h"
+#include "event_loop.h"
+#include "arena.h"
+#include "buffers.h"
+#include "station.h"
+#include "station_list.h"
+
+// the station of the single-station mode
+static struct station_t station;
+
+// rings between the pipeline stages
+static struct block_ring_t audio_ring;		// input -> input resampler
+static struct block_ring_t resampled_ring;	// input resampler -> MPX
+static struct block_ring_t mpx_ring;		// MPX -> output resampler
+static struct block_ring_t out_ring;		// output resampler -> output
 
 // pthread
-static pthread_t control_pipe_thread;
-static pthread_t input_thread;
-static pthread_t in_resampler_thread;
-static pthread_t mpx_thread;
-static pthread_t rds_thread;
-static pthread_t out_resampler_thread;
-static pthread_t output_thread;
-
-static pthread_mutex_t control_pipe_mutex	= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t input_mutex		= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t in_resampler_mutex	= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t mpx_mutex		= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t rds_mutex		= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t out_resampler_mutex	= PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t output_mutex		= PTHREAD_MUTEX_INITIALIZER;
-
-static pthread_cond_t control_pipe_cond;
-static pthread_cond_t input_cond;
-static pthread_cond_t in_resampler_cond;
-static pthread_cond_t mpx_cond;
-static pthread_cond_t rds_cond;
-static pthread_cond_t out_resampler_cond;
-static pthread_cond_t output_cond;
+static pthread_t rds_group_threads[NUM_RDS_STREAMS];
+static pthread_t group_input_thread;
 
-static uint8_t stop_mpx;
+// input, resamplers, MPX/RDS and output, or the group output
+#define MAX_PIPELINE_THREADS	5
+static pthread_t pipeline_threads[MAX_PIPELINE_THREADS];
+static uint8_t num_pipeline_threads;
 
-static void stop() {
-	stop_mpx = 1;
-}
+/* Frames per block of the threaded pipeline: read from the input, after
+ * the input resampler and the MPX encoder, and after the output resampler
+ */
+static size_t block_frames = DEFAULT_BLOCK_FRAMES;
+static size_t audio_frames;
+static size_t out_frames;
+// blocks per ring
+static uint32_t ring_depth = DEFAULT_RING_DEPTH;
 
-static void shutdown() {
-	fprintf(stderr, "Exiting...\n");
-	exit(2);
-}
+// conversion buffers of the input and output threads
+static short *input_buf;
+static short *output_buf;
 
-static void free_and_shutdown() {
-	fprintf(stderr, "Freeing buffers...\n");
-	if (mpx_buffer != NULL) free(mpx_buffer);
-	if (out_buffer != NULL) free(out_buffer);
-	if (audio_in_buffer != NULL) free(audio_in_buffer);
-	if (resampled_audio_in_buffer != NULL) free(resampled_audio_in_buffer);
-	shutdown();
-}
+static uint8_t stop_mpx;
 
 // structs for the threads
 typedef struct resample_thread_args_t {
-	SRC_STATE **state;
-	SRC_DATA data;
-	float *in;
-	float *out;
+	SRC_STATE *state;
+	double ratio;
+	struct block_ring_t *in;
+	struct block_ring_t *out;
 	size_t frames_in;
 	size_t frames_out;
-	double ratio;
+	// input frames the resampler made no progress on
+	size_t dropped;
 } resample_thread_args_t;
 
-typedef struct audio_io_thread_args_t {
-	float *data;
-	size_t frames;
-} audio_io_thread_args_t;
-
-typedef struct mpx_thread_args_t {
-	float *in;
-	float *out;
-	size_t frames;
-} mpx_thread_args_t;
-
 // threads
-static void *control_pipe_worker() {
-	while (!stop_mpx) {
-		poll_control_pipe();
-		usleep(10000);
-	}
-
-	close_control_pipe();
-	pthread_exit(NULL);
-}
-
-static void *input_worker(void *arg) {
-	int8_t r;
-	short buf[NUM_AUDIO_FRAMES_IN*2];
-	audio_io_thread_args_t *args = (audio_io_thread_args_t *)arg;
-	float *audio = args->data;
-	size_t frames = args->frames;
+static void *input_worker() {
+	float *audio;
 
 	while (!stop_mpx) {
-		r = read_input(buf);
-		if (r < 0) break;
-		short2float(buf, audio, frames*2);
-		pthread_cond_signal(&in_resampler_cond);
+		if (read_input(&station.input, input_buf) < 0) {
+			stop_event_loop();
+			break;
+		}
+		audio = get_ring_write_block(&audio_ring);
+		if (audio == NULL) break;
+		short2float(input_buf, audio, audio_frames*2);
+		commit_ring_block(&audio_ring);
 	}
 
 	pthread_exit(NULL);
 }
 
-// memcpy for copying float frames
-#define floatf_memcpy(x, y, z) memcpy(x, y, z * 2 * sizeof(float))
-
-static void *in_resampler_worker(void *arg) {
-	int8_t r;
-	static float outbuf[NUM_AUDIO_FRAMES_OUT*2];
-	static float leftoverbuf[NUM_AUDIO_FRAMES_OUT*2];
-	static size_t outframes;
-	static size_t total_outframes;
-	static size_t extra_frames;
-
+/* Resample blocks from one ring into blocks of another size in the next.
+ * One block in may fill none, one or more blocks out.
+ */
+static void *resampler_worker(void *arg) {
 	struct resample_thread_args_t *args = (struct resample_thread_args_t *)arg;
+	SRC_DATA src_data;
+	float *in;
+	float *out = NULL;
+	size_t out_frames = 0;
 
-	float *in = args->in;
-	float *out = args->out;
-	size_t frames_in = args->frames_in;
-	size_t frames_out = args->frames_out;
-	SRC_STATE *src_state = *args->state;
-	SRC_DATA src_data = args->data;
-	src_data.data_in = in;
-	src_data.data_out = outbuf;
-	src_data.input_frames = frames_in;
-	src_data.output_frames = frames_out;
+	memset(&src_data, 0, sizeof(SRC_DATA));
 	src_data.src_ratio = args->ratio;
 
 	while (!stop_mpx) {
-		pthread_cond_wait(&in_resampler_cond, &in_resampler_mutex);
-		if (extra_frames) {
-			floatf_memcpy(out, leftoverbuf, extra_frames);
-			total_outframes += extra_frames;
-			extra_frames = 0;
-		}
-		while (total_outframes < frames_out) {
-			r = resample(src_state, src_data, &outframes);
-			if (r < 0) break;
-			floatf_memcpy(src_data.data_out, outbuf + outframes, outframes);
-			src_data.data_out += outframes*2;
-			total_outframes += outframes;
-		}
-		// when there are excess frames
-		if (total_outframes > frames_out) {
-			extra_frames = total_outframes - frames_out;
-			floatf_memcpy(out, src_data.data_out, frames_out);
-			floatf_memcpy(leftoverbuf, src_data.data_out + extra_frames, extra_frames);
-		}
-		if (total_outframes == frames_out) {
-			floatf_memcpy(out, src_data.data_out, frames_out);
+		in = get_ring_read_block(args->in);
+		if (in == NULL) break;
+		src_data.data_in = in;
+		src_data.input_frames = args->frames_in;
+
+		while (src_data.input_frames) {
+			if (out == NULL) {
+				out = get_ring_write_block(args->out);
+				if (out == NULL) goto done;
+				out_frames = 0;
+			}
+			src_data.data_out = out + out_frames*2;
+			src_data.output_frames = args->frames_out - out_frames;
+			if (resample(args->state, &src_data) < 0) goto done;
+
+			src_data.data_in += src_data.input_frames_used*2;
+			src_data.input_frames -= src_data.input_frames_used;
+			out_frames += src_data.output_frames_gen;
+			if (out_frames == args->frames_out) {
+				commit_ring_block(args->out);
+				out = NULL;
+			} else if (!src_data.input_frames_used &&
+				!src_data.output_frames_gen) {
+				/* Neither consumed input nor produced output, so
+				 * trying again won't either. Count what is left of
+				 * the block rather than spin on it.
+				 */
+				args->dropped += src_data.input_frames;
+				break;
+			}
 		}
-		src_data.data_out = out;
-		total_outframes = 0;
+
+		release_ring_block(args->in);
 	}
 
+done:
 	pthread_exit(NULL);
 }
 
-static void *mpx_worker(void *arg) {
-	struct mpx_thread_args_t *args = (struct mpx_thread_args_t *)arg;
-	float *audio_in = args->in;
-	float *mpx_out = args->out;
+static void *mpx_worker() {
+	float *audio, *mpx;
 
 	while (!stop_mpx) {
-		pthread_cond_wait(&mpx_cond, &mpx_mutex);
-		fm_mpx_get_samples(audio_in, mpx_out);
-		pthread_cond_signal(&output_cond);
+		audio = get_ring_read_block(&resampled_ring);
+		if (audio == NULL) break;
+		mpx = get_ring_write_block(&mpx_ring);
+		if (mpx == NULL) break;
+		fm_mpx_get_samples(&station.mpx, audio, mpx, block_frames);
+		commit_ring_block(&mpx_ring);
+		release_ring_block(&resampled_ring);
 	}
 
 	pthread_exit(NULL);
 }
 
-static void *rds_worker(void *arg) {
-	struct mpx_thread_args_t *args = (struct mpx_thread_args_t *)arg;
-	float *rds_out = args->out;
+static void *rds_worker() {
+	float *mpx;
 
 	while (!stop_mpx) {
-		//pthread_cond_wait(&rds_cond, &rds_mutex);
-		fm_rds_get_samples(rds_out);
-		//pthread_cond_signal(&output_cond);
+		mpx = get_ring_write_block(&mpx_ring);
+		if (mpx == NULL) break;
+		fm_rds_get_samples(&station.mpx, mpx, block_frames);
+		commit_ring_block(&mpx_ring);
 	}
 
-
 	pthread_exit(NULL);
 }
 
-static void *out_resampler_worker(void *arg) {
-	int8_t r;
-	static float outbuf[NUM_MPX_FRAMES_OUT*2];
-	static float leftoverbuf[NUM_MPX_FRAMES_OUT*2];
-	static size_t outframes;
-	static size_t total_outframes;
-	static size_t extra_frames;
+static void *rds_group_worker(void *arg) {
+	uint8_t stream_num = (uintptr_t)arg;
 
-	struct resample_thread_args_t *args = (struct resample_thread_args_t *)arg;
+	// encoding groups isn't time critical as long as the FIFOs stay filled
+	setpriority(PRIO_PROCESS, syscall(SYS_gettid), 10);
 
-	float *in = args->in;
-	float *out = args->out;
-	size_t frames_in = args->frames_in;
-	size_t frames_out = args->frames_out;
-	SRC_STATE *src_state = *args->state;
-	SRC_DATA src_data = args->data;
-	src_data.data_in = in;
-	src_data.data_out = outbuf;
-	src_data.input_frames = frames_in;
-	src_data.output_frames = frames_out;
-	src_data.src_ratio = args->ratio;
+	// the modulator wakes us when it needs more groups
+	do {
+		fill_rds_group_fifo(&station.modulator, stream_num);
+	} while (wait_rds_group_fifo(&station.modulator, stream_num) == 0);
+
+	pthread_exit(NULL);
+}
+
+static void *group_input_worker() {
+	uint64_t bits[GROUP_WORDS];
 
 	while (!stop_mpx) {
-		pthread_cond_wait(&out_resampler_cond, &out_resampler_mutex);
-		if (extra_frames) {
-			floatf_memcpy(out, leftoverbuf, extra_frames);
-			total_outframes += extra_frames;
-			extra_frames = 0;
-		}
-		while (total_outframes < frames_out) {
-			r = resample(src_state, src_data, &outframes);
-			if (r < 0) break;
-			floatf_memcpy(src_data.data_out, outbuf + outframes, outframes);
-			src_data.data_out += outframes*2;
-			total_outframes += outframes;
+		if (read_group_input(bits) <= 0) {
+			if (!stop_mpx) fprintf(stderr, "Group input ended.\n");
+			break;
 		}
-		// when there are excess frames
-		if (total_outframes > frames_out) {
-			extra_frames = total_outframes - frames_out;
-			floatf_memcpy(out, src_data.data_out, frames_out);
-			floatf_memcpy(leftoverbuf, src_data.data_out + extra_frames, extra_frames);
+		// hold the sender back while the jitter buffer is full
+		while (!push_rds_input_group(&station.modulator, bits)) {
+			if (wait_rds_input_room(&station.modulator) < 0) goto done;
 		}
-		if (total_outframes == frames_out) {
-			floatf_memcpy(out, src_data.data_out, frames_out);
+	}
+
+done:
+	pthread_exit(NULL);
+}
+
+static void *group_output_worker(void *arg) {
+	uint32_t num_groups = *(uint32_t *)arg;
+
+	for (uint32_t i = 0; !stop_mpx && (!num_groups || i < num_groups); i++) {
+		if (write_group_output() < 0) {
+			fprintf(stderr, "Error writing groups.\n");
+			break;
 		}
-		src_data.data_out = out;
-		total_outframes = 0;
 	}
 
+	stop_event_loop();
 	pthread_exit(NULL);
 }
 
-static void *output_worker(void *arg) {
-	int8_t r;
-	static short buf[NUM_MPX_FRAMES_IN*2];
-	struct audio_io_thread_args_t *args = (struct audio_io_thread_args_t *)arg;
-	size_t frames = args->frames;
-	float *audio = args->data;
+static void *output_worker() {
+	float *out;
 
 	while (!stop_mpx) {
-		//pthread_cond_wait(&output_cond, &output_mutex);
-		float2short(audio, buf, frames*2);
-		r = write_output(buf, frames);
-		if (r < 0) {
-			stop_mpx = 1;
+		out = get_ring_read_block(&out_ring);
+		if (out == NULL) break;
+		float2short(out, output_buf, out_frames*2);
+		release_ring_block(&out_ring);
+		if (write_output(&station.output, output_buf, out_frames) < 0) {
+			stop_event_loop();
 			break;
 		}
-		pthread_cond_signal(&mpx_cond);
-		pthread_cond_signal(&rds_cond);
 	}
 
 	pthread_exit(NULL);
 }
 
+static void *fused_worker() {
+	while (!stop_mpx) {
+		if (render_station_block(&station) < 0) break;
+	}
+
+	stop_event_loop();
+	pthread_exit(NULL);
+}
+
+static void stats_timer(void *file) {
+	write_stats(&station, (char *)file);
+}
+
+static int8_t start_pipeline_thread(pthread_attr_t *attr, uint8_t stage,
+	void *(*worker)(void *), void *arg, char *name) {
+	if (pthread_create(&pipeline_threads[num_pipeline_threads], attr,
+		worker, arg) != 0) {
+		fprintf(stderr, "Could not create %s thread.\n", name);
+		return -1;
+	}
+	fprintf(stderr, "Created %s thread.\n", name);
+	set_stage_thread(pipeline_threads[num_pipeline_threads], stage, name);
+	num_pipeline_threads++;
+
+	return 0;
+}
+
+/* Pick the block size, and the ring depth unless one was given, so that
+ * samples take about latency_ms to get through the threaded pipeline.
+ * Each ring holds up to ring_depth blocks plus the one a stage works on.
+ */
+static void set_pipeline_latency(uint32_t latency_ms, uint8_t audio,
+	uint8_t keep_depth) {
+	// seconds each MPX frame of a block stands for, over all rings
+	double per_frame = 1.0 / MPX_SAMPLE_RATE +
+		(double)OUTPUT_BLOCK_FRAMES(1) / OUTPUT_SAMPLE_RATE;
+	double frames;
+
+	if (audio) {
+		// assuming CD rate audio, the input ring only adds a little
+		per_frame += 1.0 / MPX_SAMPLE_RATE +
+			(double)AUDIO_BLOCK_FRAMES(1.0) / 44100;
+	}
+
+	for (;;) {
+		frames = latency_ms / 1000.0 / (ring_depth + 1) / per_frame;
+		if (frames <= MAX_BLOCK_FRAMES || keep_depth ||
+			ring_depth == MAX_RING_DEPTH) break;
+		// long targets: more blocks in flight rather than huge ones
+		ring_depth *= 2;
+	}
+
+	if (frames < MIN_BLOCK_FRAMES) frames = MIN_BLOCK_FRAMES;
+	if (frames > MAX_BLOCK_FRAMES) frames = MAX_BLOCK_FRAMES;
+	block_frames = (size_t)frames & ~(size_t)7;
+}
+
+/* Memory the pipeline buffers need at most, see init_fused_pipeline and
+ * the ring setup in main
+ */
+static size_t get_pipeline_memory(size_t fused_frames) {
+	if (fused_frames) return get_fused_pipeline_memory(fused_frames);
+
+	return ring_depth * (audio_frames + 2 * block_frames + out_frames) *
+		2 * sizeof(float) +
+		(audio_frames + out_frames) * 2 * sizeof(short) +
+		6 * ARENA_ALIGN;
+}
+
 static void show_help(char *name, struct rds_params_t def_params) {
 	fprintf(stderr,
 		"This is Mpxgen, a lightweight Stereo and RDS encoder.\n"
@@ -317,12 +355,63 @@ static void show_help(char *name, struct rds_params_t def_params) {
 		"    -P / --ptyn         PTY Name\n"
 		"    -S / --callsign     Callsign to calculate the PI code from\n"
 		"                        (overrides -i/--pi)\n"
+		"    -G / --group-rates  Group repetition rates in groups/s\n"
+		"                        [default: 0A=4.5,2A=4.5,3A=0.5,10A=1,11A=0.5]\n"
 		"    -C / --ctl          Control pipe\n"
+		"    -U / --uecp         UECP server on tcp:PORT or a Unix socket\n"
+		"    -u / --uecp-address UECP site and encoder address (SITE:ENCODER)\n"
+#ifdef RDS2
+		"    -L / --logo         Station logo to send over RDS2\n"
+		"                        ([STREAM,]FILE)\n"
+#endif
+		"    -Q / --sequence     Playlist of timed PS/RT/RT+ commands\n"
+		"    -Y / --stats-file   Write RDS channel statistics to a file\n"
+		"                        every %d seconds\n"
+		"\n"
+		"[Group output]\n"
+		"\n"
+		"    -g / --group-output Write the encoded RDS groups to a file\n"
+		"                        instead of modulating them\n"
+		"    -F / --group-format Group output format: hex or bin [default: hex]\n"
+		"    -N / --groups       Stop after this many groups\n"
+		"    -X / --group-pace   Pace group output at 11.4 groups/s\n"
+		"    -I / --group-input  Modulate groups read from a file, pipe\n"
+		"                        or tcp:PORT (uses --group-format)\n"
+		"\n"
+		"[Real-time]\n"
+		"\n"
+		"    -E / --rt-priority  Real-time priorities of the pipeline stages\n"
+		"                        (STAGE=PRIO,... with input, resampler,\n"
+		"                        mpx, output or all)\n"
+		"    -e / --rt-policy    Real-time policy: fifo or rr [default: fifo]\n"
+		"    -c / --cpus         CPUs of the pipeline stages as hex masks\n"
+		"                        (STAGE=MASK,...)\n"
+		"    -k / --isolate-cpus Reserve these CPUs (hex mask) for the pipeline\n"
+		"    -M / --mlock        Lock all memory to avoid page faults\n"
+		"    -H / --huge-pages   Put the buffers on huge pages\n"
+		"    -t / --single-thread Run the pipeline on one thread in blocks\n"
+		"                        of this many frames, for low latency\n"
+		"    -b / --block-size   Frames per block at the MPX rate\n"
+		"                        [default: %d]\n"
+		"    -d / --depth        Blocks in flight per pipeline stage\n"
+		"                        [default: %d]\n"
+		"    -l / --latency-ms   Pick the block size and depth for\n"
+		"                        this pipeline latency\n"
+		"\n"
+		"[Stations]\n"
+		"\n"
+		"    -j / --stations     Run the stations of this list in one\n"
+		"                        process, on a pool of worker threads\n"
+		"                        (blocks of --single-thread frames,\n"
+		"                        default: %d)\n"
 		"\n",
 		name,
 		def_params.pi, def_params.ps,
 		def_params.rt, def_params.pty,
-		def_params.tp
+		def_params.tp,
+		STATS_INTERVAL,
+		DEFAULT_BLOCK_FRAMES, DEFAULT_RING_DEPTH,
+		DEFAULT_STATION_FRAMES
 	);
 }
 
@@ -340,6 +429,9 @@ int main(int argc, char **argv) {
 	char audio_file[64] = {0};
 	char output_file[64] = {0};
 	char control_pipe[51] = {0};
+	char uecp[64] = {0};
+	uint16_t uecp_site = 0;
+	uint8_t uecp_encoder = 0;
 	uint8_t rds = 1;
 	struct rds_params_t rds_params = {
 		.ps = "Mpxgen",
@@ -352,19 +444,41 @@ int main(int argc, char **argv) {
 	char tmp_ptyn[9] = {0};
 	uint8_t mpx = 50;
 	uint8_t wait = 1;
+	char group_file[64] = {0};
+	uint8_t group_format = GROUP_FORMAT_HEX;
+	uint32_t num_groups = 0;
+	uint8_t group_pace = 0;
+	char group_input[64] = {0};
+	char sequence[64] = {0};
+	char stats_file[64] = {0};
+	char group_rates[64] = {0};
+	char station_list[PATH_MAX] = {0};
+	struct station_defaults_t station_defaults;
+#ifdef RDS2
+	char logo[PATH_MAX] = {0};
+#endif
 
 	int8_t r;
 
 	// SRC
-	SRC_STATE *src_state[2];
-	SRC_DATA src_data[2];
+	struct resample_thread_args_t in_resampler_args = {0};
+	struct resample_thread_args_t out_resampler_args = {0};
+	size_t fused_frames = 0;
+	uint32_t sample_rate = 0;
 
 	uint8_t output_open_success = 0;
+	uint8_t num_group_threads = 0;
+	uint8_t group_input_started = 0;
+	uint8_t block_given = 0;
+	uint8_t depth_given = 0;
+	uint32_t latency_ms = 0;
+	float ct_latency;
+	float audio_latency = 0.0f;
 
 	// pthread
 	pthread_attr_t attr;
 
-	const char	*short_opt = "a:o:m:W:R:i:s:r:p:T:A:P:S:C:h";
+	const char	*short_opt = "a:o:m:W:R:i:s:r:p:T:A:P:S:G:C:U:u:L:Q:Y:g:F:N:X:I:E:e:c:k:M:H:t:b:d:l:j:h";
 	struct option	long_opt[] =
 	{
 		{"audio",	required_argument, NULL, 'a'},
@@ -382,7 +496,34 @@ int main(int argc, char **argv) {
 		{"af",		required_argument, NULL, 'A'},
 		{"ptyn",	required_argument, NULL, 'P'},
 		{"callsign",	required_argument, NULL, 'S'},
+		{"group-rates",	required_argument, NULL, 'G'},
 		{"ctl",		required_argument, NULL, 'C'},
+		{"uecp",	required_argument, NULL, 'U'},
+		{"uecp-address",	required_argument, NULL, 'u'},
+#ifdef RDS2
+		{"logo",	required_argument, NULL, 'L'},
+#endif
+		{"sequence",	required_argument, NULL, 'Q'},
+		{"stats-file",	required_argument, NULL, 'Y'},
+
+		{"group-output",	required_argument, NULL, 'g'},
+		{"group-format",	required_argument, NULL, 'F'},
+		{"groups",	required_argument, NULL, 'N'},
+		{"group-pace",	required_argument, NULL, 'X'},
+		{"group-input",	required_argument, NULL, 'I'},
+
+		{"rt-priority",	required_argument, NULL, 'E'},
+		{"rt-policy",	required_argument, NULL, 'e'},
+		{"cpus",	required_argument, NULL, 'c'},
+		{"isolate-cpus",	required_argument, NULL, 'k'},
+		{"mlock",	required_argument, NULL, 'M'},
+		{"huge-pages",	required_argument, NULL, 'H'},
+		{"single-thread",	required_argument, NULL, 't'},
+		{"block-size",	required_argument, NULL, 'b'},
+		{"depth",	required_argument, NULL, 'd'},
+		{"latency-ms",	required_argument, NULL, 'l'},
+
+		{"stations",	required_argument, NULL, 'j'},
 
 		{"help",	no_argument, NULL, 'h'},
 		{ 0,		0,		0,	0 }
@@ -446,10 +587,139 @@ int main(int argc, char **argv) {
 				strncpy(callsign, optarg, 4);
 				break;
 
+			case 'G': //group-rates
+				strncpy(group_rates, optarg, 63);
+				break;
+
 			case 'C': //ctl
 				strncpy(control_pipe, optarg, 50);
 				break;
 
+			case 'U': //uecp
+				strncpy(uecp, optarg, 63);
+				break;
+
+			case 'u': //uecp-address
+				if (sscanf(optarg, "%hu:%hhu", &uecp_site, &uecp_encoder) != 2 ||
+					uecp_site > 1023 || uecp_encoder > 63) {
+					fprintf(stderr, "UECP address must be SITE:ENCODER "
+						"(0-1023:0-63).\n");
+					return 1;
+				}
+				break;
+
+#ifdef RDS2
+			case 'L': //logo
+				strncpy(logo, optarg, PATH_MAX - 1);
+				break;
+
+#endif
+			case 'Q': //sequence
+				strncpy(sequence, optarg, 63);
+				break;
+
+			case 'Y': //stats-file
+				strncpy(stats_file, optarg, 63);
+				break;
+
+			case 'g': //group-output
+				strncpy(group_file, optarg, 63);
+				break;
+
+			case 'F': //group-format
+				if (strcmp(optarg, "hex") == 0) {
+					group_format = GROUP_FORMAT_HEX;
+				} else if (strcmp(optarg, "bin") == 0) {
+					group_format = GROUP_FORMAT_BIN;
+				} else {
+					fprintf(stderr, "Group format must be hex or bin.\n");
+					return 1;
+				}
+				break;
+
+			case 'N': //groups
+				num_groups = strtoul(optarg, NULL, 10);
+				break;
+
+			case 'X': //group-pace
+				group_pace = strtoul(optarg, NULL, 10);
+				break;
+
+			case 'I': //group-input
+				strncpy(group_input, optarg, 63);
+				break;
+
+			case 'E': //rt-priority
+				if (set_rt_priorities(optarg) < 0) return 1;
+				break;
+
+			case 'e': //rt-policy
+				if (set_rt_policy(optarg) < 0) return 1;
+				break;
+
+			case 'c': //cpus
+				if (set_stage_cpus(optarg) < 0) return 1;
+				break;
+
+			case 'k': //isolate-cpus
+				if (set_isolated_cpus(optarg) < 0) return 1;
+				break;
+
+			case 'M': //mlock
+				set_memory_lock(strtoul(optarg, NULL, 10));
+				break;
+
+			case 'H': //huge-pages
+				set_huge_pages(strtoul(optarg, NULL, 10));
+				break;
+
+			case 't': //single-thread
+				fused_frames = strtoul(optarg, NULL, 10);
+				if (fused_frames < 16 ||
+					fused_frames > MAX_FUSED_FRAMES) {
+					fprintf(stderr, "Block size must be between "
+						"16 - %d frames.\n", MAX_FUSED_FRAMES);
+					return 1;
+				}
+				break;
+
+			case 'b': //block-size
+				block_frames = strtoul(optarg, NULL, 10);
+				if (block_frames < MIN_BLOCK_FRAMES ||
+					block_frames > MAX_BLOCK_FRAMES ||
+					block_frames % 8) {
+					fprintf(stderr, "Block size must be a multiple "
+						"of 8 between %d - %d frames.\n",
+						MIN_BLOCK_FRAMES, MAX_BLOCK_FRAMES);
+					return 1;
+				}
+				block_given = 1;
+				break;
+
+			case 'd': //depth
+				ring_depth = strtoul(optarg, NULL, 10);
+				if (ring_depth < 1 || ring_depth > MAX_RING_DEPTH ||
+					ring_depth & (ring_depth - 1)) {
+					fprintf(stderr, "Depth must be 1, 2, 4, 8 "
+						"or 16 blocks.\n");
+					return 1;
+				}
+				depth_given = 1;
+				break;
+
+			case 'l': //latency-ms
+				latency_ms = strtoul(optarg, NULL, 10);
+				if (!latency_ms) {
+					fprintf(stderr, "Latency must be at least "
+						"1 ms.\n");
+					return 1;
+				}
+				break;
+
+			case 'j': //stations
+				strncpy(station_list, optarg, PATH_MAX - 1);
+				break;
+
 			case 'h': //help
 			case '?':
 			default:
@@ -458,236 +728,321 @@ int main(int argc, char **argv) {
 		}
 	}
 
+	if (station_list[0]) {
+		if (audio_file[0] || output_file[0] || control_pipe[0] ||
+			uecp[0] || group_file[0] || group_input[0] ||
+			sequence[0] || stats_file[0]) {
+			fprintf(stderr, "Give the inputs, outputs and control "
+				"pipes of the stations in the station list.\n");
+			return 1;
+		}
+		if (read_station_list(station_list) < 0) return 1;
+		if (!fused_frames) fused_frames = DEFAULT_STATION_FRAMES;
+
+		pthread_attr_init(&attr);
+		if (init_realtime(&attr) < 0) return 1;
+		if (init_event_loop() < 0) return 1;
+		if (init_arena(DSP_MEMORY_SIZE +
+			get_station_list_memory(fused_frames)) < 0) goto free;
+		init_station_tables();
+
+		station_defaults.rds_params = rds_params;
+		station_defaults.callsign = callsign;
+		station_defaults.group_rates = group_rates[0] ? group_rates : NULL;
+		station_defaults.mpx = mpx;
+		station_defaults.rds = rds;
+		station_defaults.wait = wait;
+		station_defaults.frames = fused_frames;
+
+		if (open_station_list(&station_defaults) == 0 &&
+			start_station_list(&attr) == 0) {
+			pthread_attr_destroy(&attr);
+			report_arena();
+			run_event_loop();
+			fprintf(stderr, "Stopping...\n");
+		}
+		stop_station_list();
+		close_station_list();
+		goto free;
+	}
+
 	if (!audio_file[0] && !rds) {
 		fprintf(stderr, "Nothing to do. Exiting.\n");
 		return 1;
 	}
 
-	// Initialize pthread stuff
-	pthread_mutex_init(&control_pipe_mutex, NULL);
-	pthread_mutex_init(&input_mutex, NULL);
-	pthread_mutex_init(&in_resampler_mutex, NULL);
-	pthread_mutex_init(&mpx_mutex, NULL);
-	pthread_mutex_init(&rds_mutex, NULL);
-	pthread_mutex_init(&out_resampler_mutex, NULL);
-	pthread_mutex_init(&output_mutex, NULL);
-	pthread_cond_init(&control_pipe_cond, NULL);
-	pthread_cond_init(&input_cond, NULL);
-	pthread_cond_init(&in_resampler_cond, NULL);
-	pthread_cond_init(&mpx_cond, NULL);
-	pthread_cond_init(&rds_cond, NULL);
-	pthread_cond_init(&out_resampler_cond, NULL);
-	pthread_cond_init(&output_cond, NULL);
+	if (latency_ms) {
+		if (block_given) {
+			fprintf(stderr, "Use either --block-size or --latency-ms.\n");
+			return 1;
+		}
+		set_pipeline_latency(latency_ms, audio_file[0], depth_given);
+	}
+	audio_frames = AUDIO_BLOCK_FRAMES(block_frames);
+	out_frames = OUTPUT_BLOCK_FRAMES(block_frames);
+
 	pthread_attr_init(&attr);
+	if (init_realtime(&attr) < 0) return 1;
+
+	// SIGINT and SIGTERM stop the event loop from here on
+	if (init_event_loop() < 0) return 1;
+
+	// all buffers come from here, nothing is allocated once running
+	if (init_arena(DSP_MEMORY_SIZE +
+		get_pipeline_memory(fused_frames)) < 0) goto free;
+
+	// Initialize the RDS encoder, modulator and baseband generator
+	init_station_tables();
+	init_station(&station, NUM_RDS_STREAMS);
+	set_output_volume(&station.mpx, mpx);
+
+	if (!rds) set_carrier_volume(&station.mpx, 1, 0);
+	if (group_rates[0] &&
+		set_rds_group_rates(&station.rds, group_rates) < 0) goto free;
+	if (group_input[0]) {
+		// only PS and PI are sent locally when the input runs dry
+		set_rds_group_rates(&station.rds, "2A=0,3A=0,10A=0,11A=0");
+	}
+	set_rds_params(&station.rds, rds_params, callsign);
+	show_rds_params(&station.rds);
+	if (sequence[0] &&
+		load_command_sequence(&station.sequencer, sequence) < 0) goto free;
+#ifdef RDS2
+	if (logo[0] && parse_rds2_logo(logo) < 0) goto free;
+#endif
+
+	// Initialize the control pipe reader (run by the event loop)
+	if(control_pipe[0]) {
+		if(open_control_pipe(&station.ctl, control_pipe, &station) == 0) {
+			fprintf(stderr, "Reading control commands on %s.\n", control_pipe);
+		} else {
+			fprintf(stderr, "Failed to open control pipe: %s.\n", control_pipe);
+		}
+	}
 
-	// Setup buffers
-	mpx_buffer = malloc(NUM_MPX_FRAMES_IN*2*sizeof(float));
-	out_buffer = malloc(NUM_MPX_FRAMES_OUT*2*sizeof(float));
+	// Start the UECP server
+	if (uecp[0]) {
+		if (open_uecp_server(&station.rds, uecp, uecp_site, uecp_encoder) == 0) {
+			fprintf(stderr, "Accepting UECP on %s.\n", uecp);
+		}
+	}
 
-	// Gracefully stop the encoder on SIGINT or SIGTERM
-	signal(SIGINT, stop);
-	signal(SIGTERM, stop);
+	if (stats_file[0] && add_event_timer(STATS_INTERVAL * 1000,
+		stats_timer, stats_file) < 0) goto free;
 
-	signal(SIGSEGV, free_and_shutdown);
-	signal(SIGKILL, free_and_shutdown);
+	if (group_file[0]) {
+		// Write the groups instead of modulating them
+		r = open_group_output(&station.rds, group_file, group_format,
+			group_pace);
+		if (r < 0) goto free;
+		report_arena();
+
+		if (start_pipeline_thread(&attr, STAGE_OUTPUT, group_output_worker,
+			&num_groups, "group output") == 0) {
+			run_event_loop();
+			stop_mpx = 1;
+			pthread_join(pipeline_threads[0], NULL);
+		}
 
-	// Initialize the baseband generator
-	fm_mpx_init();
-	set_output_volume(mpx);
+		close_group_output();
+		if (stats_file[0]) write_stats(&station, stats_file);
+		close_control_pipe(&station.ctl);
+		close_uecp_server();
+		goto free;
+	}
 
-	// Initialize the RDS modulator
-	if (!rds) set_carrier_volume(1, 0);
-	init_rds_encoder(rds_params, callsign);
+	// start RDS group producer threads
+	enable_rds_group_fifos(&station.modulator);
+	for (uint8_t i = 0; i < NUM_RDS_STREAMS; i++) {
+		r = pthread_create(&rds_group_threads[i], &attr, rds_group_worker,
+			(void *)(uintptr_t)i);
+		if (r != 0) {
+			fprintf(stderr, "Could not create RDS group thread.\n");
+			goto exit;
+		}
+		num_group_threads++;
+	}
+	fprintf(stderr, "Created RDS group threads.\n");
+
+	if (group_input[0]) {
+		if (open_group_input(group_input, group_format) < 0) goto exit;
+		enable_rds_group_input(&station.modulator);
+		r = pthread_create(&group_input_thread, &attr, group_input_worker, NULL);
+		if (r != 0) {
+			fprintf(stderr, "Could not create group input thread.\n");
+			goto exit;
+		} else {
+			fprintf(stderr, "Created group input thread.\n");
+			group_input_started = 1;
+		}
+	}
 
 	if (output_file[0] == 0) {
-		r = open_output("alsa:default", OUTPUT_SAMPLE_RATE, 2);
+		r = open_output(&station.output, "alsa:default", OUTPUT_SAMPLE_RATE, 2);
 		if (r < 0) {
 			goto free;
 		}
 		output_open_success = 1;
 	} else {
-		r = open_output(output_file, OUTPUT_SAMPLE_RATE, 2);
+		r = open_output(&station.output, output_file, OUTPUT_SAMPLE_RATE, 2);
 		if (r < 0) {
 			goto free;
 		}
 		output_open_success = 1;
 	}
 
-	if (output_open_success) {
-		struct audio_io_thread_args_t output_thread_args;
-		output_thread_args.data = out_buffer;
-		output_thread_args.frames = NUM_MPX_FRAMES_OUT;
-		// start output thread
-		r = pthread_create(&output_thread, &attr, output_worker, (void *)&output_thread_args);
-		if (r < 0) {
-			fprintf(stderr, "Could not create audio output thread.\n");
-			goto exit;
-		} else {
-			fprintf(stderr, "Created output thread.\n");
-		}
-	}
-
 	if (audio_file[0]) {
-		audio_in_buffer = malloc(NUM_AUDIO_FRAMES_IN*2*sizeof(float));
-		resampled_audio_in_buffer = malloc(NUM_AUDIO_FRAMES_OUT*2*sizeof(float));
-
-		uint32_t sample_rate;
-		r = open_input(audio_file, wait, &sample_rate, NUM_AUDIO_FRAMES_IN);
+		r = open_input(&station.input, audio_file, wait, &sample_rate,
+			fused_frames ? fused_frames : audio_frames);
 		if (r < 0) goto free;
 
 		// SRC in (input -> MPX)
-		r = resampler_init(&src_state[0], 2);
+		r = resampler_init(&station.in_src, 2);
 		if (r < 0) {
 			fprintf(stderr, "Could not create input resampler.\n");
 			goto exit;
 		}
-
-		memset(&src_data[0], 0, sizeof(src_data[0]));
-
-		struct resample_thread_args_t in_resampler_args;
-		memset(&in_resampler_args, 0, sizeof(struct resample_thread_args_t));
-		in_resampler_args.state = &src_state[0];
-		in_resampler_args.data = src_data[0];
-		in_resampler_args.in = audio_in_buffer;
-		in_resampler_args.out = resampled_audio_in_buffer;
-		in_resampler_args.frames_in = NUM_AUDIO_FRAMES_IN;
-		in_resampler_args.frames_out = NUM_AUDIO_FRAMES_OUT;
-		in_resampler_args.ratio = (double)MPX_SAMPLE_RATE / (double)sample_rate;
-
-		// start input resampler thread
-		r = pthread_create(&in_resampler_thread, &attr, in_resampler_worker, (void *)&in_resampler_args);
-		if (r < 0) {
-			fprintf(stderr, "Could not create input resampler thread.\n");
-			goto exit;
-		} else {
-			fprintf(stderr, "Created input resampler thread.\n");
-		}
-
-		struct audio_io_thread_args_t input_thread_args;
-		input_thread_args.data = audio_in_buffer;
-		input_thread_args.frames = NUM_AUDIO_FRAMES_IN;
-
-		// start audio input thread
-		r = pthread_create(&input_thread, &attr, input_worker, (void *)&input_thread_args);
-		if (r < 0) {
-			fprintf(stderr, "Could not create file input thread.\n");
-			goto exit;
-		} else {
-			fprintf(stderr, "Created file input thread.\n");
-		}
 	}
 
-	// Initialize the control pipe reader
-	if(control_pipe[0]) {
-		if(open_control_pipe(control_pipe) == 0) {
-			fprintf(stderr, "Reading control commands on %s.\n", control_pipe);
-			// Create control pipe polling worker
-			r = pthread_create(&control_pipe_thread, &attr, control_pipe_worker, NULL);
-			if (r < 0) {
-				fprintf(stderr, "Could not create control pipe thread.\n");
-				goto exit;
-			} else {
-				fprintf(stderr, "Created control pipe thread.\n");
-			}
-		} else {
-			fprintf(stderr, "Failed to open control pipe: %s.\n", control_pipe);
-		}
-	}
-
-	// start MPX resampler thread
-	// SRC in (input -> MPX)
-	r = resampler_init(&src_state[2], 2);
+	// SRC out (MPX -> output)
+	r = resampler_init(&station.out_src, 2);
 	if (r < 0) {
 		fprintf(stderr, "Could not create ouput resampler.\n");
 		goto exit;
 	}
 
-	memset(&src_data[1], 0, sizeof(src_data[1]));
-
-	struct resample_thread_args_t out_resampler_args;
-	memset(&out_resampler_args, 0, sizeof(struct resample_thread_args_t));
-	out_resampler_args.state = &src_state[1];
-	out_resampler_args.data = src_data[1];
-	out_resampler_args.in = mpx_buffer;
-	out_resampler_args.out = out_buffer;
-	out_resampler_args.frames_in = NUM_MPX_FRAMES_IN;
-	out_resampler_args.frames_out = NUM_MPX_FRAMES_OUT;
-	out_resampler_args.ratio = (double)OUTPUT_SAMPLE_RATE / (double)MPX_SAMPLE_RATE;
+	if (fused_frames) {
+		if (init_fused_pipeline(&station, fused_frames, sample_rate) < 0)
+			goto exit;
+		ct_latency = station.pipeline.ct_latency;
+		audio_latency = station.pipeline.audio_latency;
 
-	// start output resampler thread
-	r = pthread_create(&in_resampler_thread, &attr, out_resampler_worker, (void *)&out_resampler_args);
-	if (r < 0) {
-		fprintf(stderr, "Could not create output resampler thread.\n");
-		goto exit;
+		if (start_pipeline_thread(&attr, STAGE_OUTPUT, fused_worker,
+			NULL, "pipeline") < 0) goto exit;
 	} else {
-		fprintf(stderr, "Created output resampler thread.\n");
-	}
-
-	// start MPX thread
-	struct mpx_thread_args_t mpx_thread_args;
-	mpx_thread_args.out = out_buffer;
-	mpx_thread_args.frames = NUM_MPX_FRAMES_OUT;
-	if (audio_file[0]) {
-		mpx_thread_args.in = resampled_audio_in_buffer;
-		r = pthread_create(&mpx_thread, &attr, mpx_worker, (void *)&mpx_thread_args);
-		if (r < 0) {
-			fprintf(stderr, "Could not create MPX thread.\n");
+		/* about how long modulated samples take to reach the output:
+		 * the rings run full, plus the block each stage is working on
+		 */
+		ct_latency = (ring_depth + 1) *
+			((float)block_frames / MPX_SAMPLE_RATE +
+			(float)out_frames / OUTPUT_SAMPLE_RATE);
+		set_rds_ct_latency(&station.rds, ct_latency);
+
+		if (init_block_ring(&mpx_ring, block_frames*2, ring_depth) < 0 ||
+			init_block_ring(&out_ring, out_frames*2, ring_depth) < 0)
 			goto exit;
-		} else {
-			fprintf(stderr, "Created MPX thread.\n");
+		output_buf = arena_alloc(out_frames * 2 * sizeof(short));
+		if (output_buf == NULL) goto exit;
+
+		if (output_open_success) {
+			if (start_pipeline_thread(&attr, STAGE_OUTPUT, output_worker,
+				NULL, "output") < 0) goto exit;
 		}
-		pthread_cond_signal(&mpx_cond);
-	} else {
-		r = pthread_create(&rds_thread, &attr, rds_worker, (void *)&mpx_thread_args);
-		if (r < 0) {
-			fprintf(stderr, "Could not create RDS thread.\n");
-			goto exit;
+
+		if (audio_file[0]) {
+			if (init_block_ring(&audio_ring, audio_frames*2,
+				ring_depth) < 0 ||
+				init_block_ring(&resampled_ring, block_frames*2,
+				ring_depth) < 0) goto exit;
+			input_buf = arena_alloc(audio_frames * 2 * sizeof(short));
+			if (input_buf == NULL) goto exit;
+
+			// audio is read and resampled before it meets the RDS signal
+			audio_latency = (ring_depth + 1) *
+				((float)audio_frames / sample_rate +
+				(float)block_frames / MPX_SAMPLE_RATE);
+			set_command_latency(&station.schedule,
+				audio_latency + ct_latency);
+
+			in_resampler_args.state = station.in_src;
+			in_resampler_args.ratio = (double)MPX_SAMPLE_RATE / (double)sample_rate;
+			in_resampler_args.in = &audio_ring;
+			in_resampler_args.out = &resampled_ring;
+			in_resampler_args.frames_in = audio_frames;
+			in_resampler_args.frames_out = block_frames;
+
+			if (start_pipeline_thread(&attr, STAGE_RESAMPLER, resampler_worker,
+				&in_resampler_args, "input resampler") < 0) goto exit;
+			if (start_pipeline_thread(&attr, STAGE_INPUT, input_worker, NULL,
+				"file input") < 0) goto exit;
+		}
+
+		out_resampler_args.state = station.out_src;
+		out_resampler_args.ratio = (double)OUTPUT_SAMPLE_RATE / (double)MPX_SAMPLE_RATE;
+		out_resampler_args.in = &mpx_ring;
+		out_resampler_args.out = &out_ring;
+		out_resampler_args.frames_in = block_frames;
+		out_resampler_args.frames_out = out_frames;
+
+		if (start_pipeline_thread(&attr, STAGE_RESAMPLER, resampler_worker,
+			&out_resampler_args, "output resampler") < 0) goto exit;
+
+		// start MPX thread
+		if (audio_file[0]) {
+			if (start_pipeline_thread(&attr, STAGE_MPX, mpx_worker, NULL,
+				"MPX") < 0) goto exit;
 		} else {
-			fprintf(stderr, "Created RDS thread.\n");
+			if (start_pipeline_thread(&attr, STAGE_MPX, rds_worker, NULL,
+				"RDS") < 0) goto exit;
 		}
-		pthread_cond_signal(&rds_cond);
 	}
 
 	pthread_attr_destroy(&attr);
-
-	for (;;) {
-		if (stop_mpx) {
-			fprintf(stderr, "Stopping...\n");
-			break;
-		}
-		usleep(100000);
+	report_arena();
+	if (fused_frames) {
+		fprintf(stderr, "Pipeline latency: %.1f ms (single thread, "
+			"%zu frame blocks).\n", (audio_latency + ct_latency) * 1000,
+			fused_frames);
+	} else {
+		fprintf(stderr, "Pipeline latency: %.1f ms (%zu frame blocks, "
+			"%u per stage).\n", (audio_latency + ct_latency) * 1000,
+			block_frames, ring_depth);
 	}
 
+	// sleeps until a signal, a stage giving up or a command to handle
+	run_event_loop();
+	fprintf(stderr, "Stopping...\n");
+
 exit:
 	// shut down threads
 	fprintf(stderr, "Waiting for threads to shut down.\n");
-	pthread_cond_signal(&input_cond);
-	pthread_cond_signal(&in_resampler_cond);
-	pthread_cond_signal(&mpx_cond);
-	pthread_cond_signal(&rds_cond);
-	pthread_cond_signal(&output_cond);
-	pthread_join(control_pipe_thread, NULL);
-	pthread_join(input_thread, NULL);
-	pthread_join(in_resampler_thread, NULL);
-	pthread_join(mpx_thread, NULL);
-	pthread_join(rds_thread, NULL);
-	pthread_join(out_resampler_thread, NULL);
-	pthread_join(output_thread, NULL);
-
-	if (audio_file[0]) close_input();
-	close_output();
-	if (audio_file[0]) resampler_exit(src_state[0]);
-	resampler_exit(src_state[1]);
-
-	fm_mpx_exit();
+	stop_mpx = 1;
+	close_block_ring(&audio_ring);
+	close_block_ring(&resampled_ring);
+	close_block_ring(&mpx_ring);
+	close_block_ring(&out_ring);
+	close_rds_group_fifos(&station.modulator);
+	for (uint8_t i = 0; i < num_pipeline_threads; i++) {
+		pthread_join(pipeline_threads[i], NULL);
+	}
+	for (uint8_t i = 0; i < num_group_threads; i++) {
+		pthread_join(rds_group_threads[i], NULL);
+	}
+	if (in_resampler_args.dropped) {
+		fprintf(stderr, "Input resampler dropped %zu frames.\n",
+			in_resampler_args.dropped);
+	}
+	if (out_resampler_args.dropped) {
+		fprintf(stderr, "Output resampler dropped %zu frames.\n",
+			out_resampler_args.dropped);
+	}
+	close_control_pipe(&station.ctl);
+	close_uecp_server();
+	if (group_input_started) {
+		// may be waiting for the sender
+		stop_group_input();
+		pthread_join(group_input_thread, NULL);
+	}
+	if (group_input[0]) close_group_input();
+
+	if (audio_file[0]) close_input(&station.input);
+	close_output(&station.output);
+	if (station.in_src) resampler_exit(station.in_src);
+	if (station.out_src) resampler_exit(station.out_src);
 
 free:
-	if (audio_file[0]) {
-		if (audio_in_buffer != NULL) free(audio_in_buffer);
-		if (resampled_audio_in_buffer != NULL) free(resampled_audio_in_buffer);
-	}
-	if (mpx_buffer != NULL) free(mpx_buffer);
-	if (out_buffer != NULL) free(out_buffer);
+	exit_event_loop();
+	exit_arena();
 
 	return 0;
 }
@@ -0,0 +1,68 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPXGEN_H
+#define MPXGEN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * libmpxgen
+ *
+ * An encoder instance renders the FM multiplex signal into buffers owned
+ * by the caller. Instances share nothing that changes, so any number of
+ * them can run in one process, each on whatever thread the caller likes.
+ * Rendering runs on the calling thread and doesn't allocate memory. The
+ * RDS data may be changed from another thread while an instance renders.
+ *
+ * Audio in and MPX out run at MPXGEN_SAMPLE_RATE, as interleaved stereo
+ * floats. Both output channels carry the same signal.
+ */
+#define MPXGEN_SAMPLE_RATE	190000
+
+enum mpxgen_modes {
+	MPXGEN_COMPOSITE,	// stereo audio in, audio, pilot and RDS out
+	MPXGEN_RDS_ONLY		// pilot and RDS out, no audio
+};
+
+typedef struct mpxgen_t mpxgen_t;
+
+extern mpxgen_t *mpxgen_create(uint8_t mode);
+extern void mpxgen_destroy(mpxgen_t *gen);
+
+/* Changes made between begin and end go on air in the same group */
+extern void mpxgen_begin_update(mpxgen_t *gen);
+extern void mpxgen_end_update(mpxgen_t *gen);
+extern void mpxgen_set_pi(mpxgen_t *gen, uint16_t pi);
+extern void mpxgen_set_ps(mpxgen_t *gen, const char *ps);
+extern void mpxgen_set_rt(mpxgen_t *gen, const char *rt);
+extern void mpxgen_set_pty(mpxgen_t *gen, uint8_t pty);
+extern void mpxgen_set_ptyn(mpxgen_t *gen, const char *ptyn);
+extern void mpxgen_set_ta(mpxgen_t *gen, uint8_t ta);
+extern void mpxgen_set_tp(mpxgen_t *gen, uint8_t tp);
+extern void mpxgen_set_ms(mpxgen_t *gen, uint8_t ms);
+extern int8_t mpxgen_set_af(mpxgen_t *gen, const float *freqs, uint8_t num);
+extern int8_t mpxgen_set_group_rates(mpxgen_t *gen, const char *rates);
+extern void mpxgen_set_volume(mpxgen_t *gen, uint8_t volume);
+extern void mpxgen_set_latency(mpxgen_t *gen, float latency);
+
+extern void mpxgen_render(mpxgen_t *gen, const float *in, float *out,
+	size_t frames);
+
+#endif /* MPXGEN_H */
@@ -19,9 +19,7 @@
 #include "common.h"
 #include "output.h"
 
-static int output_type;
-
-int open_output(char *output_name, unsigned int sample_rate, unsigned int channels) {
+int open_output(struct output_t *out, char *output_name, unsigned int sample_rate, unsigned int channels) {
 	// TODO: better detect live capture cards
 	if (output_name[0] == 'p' && output_name[1] == 'u' &&
 	    output_name[2] == 'l' && output_name[3] == 's' &&
@@ -32,33 +30,33 @@ int open_output(char *output_name, unsigned int sample_rate, unsigned int channe
 			fprintf(stderr, "Could not open pulse sink.\n");
 			return -1;
 		}
-		output_type = 2;
+		out->type = 2;
 	} else {
 		fprintf(stderr, "Writing MPX output to \"%s\".\n", output_name);
-		if (open_file_output(output_name, sample_rate, channels) < 0) {
+		if (open_file_output(&out->file, output_name, sample_rate, channels) < 0) {
 			return -1;
 		}
-		output_type = 1;
+		out->type = 1;
 	}
 	return 1;
 }
 
-int write_output(short *audio, size_t frames) {
-	if (output_type == 1) {
-		if (write_file_output(audio, frames) < 0) return -1;
+int write_output(struct output_t *out, short *audio, size_t frames) {
+	if (out->type == 1) {
+		if (write_file_output(&out->file, audio, frames) < 0) return -1;
 	}
-	if (output_type == 2) {
+	if (out->type == 2) {
 		if (write_pulse_output(audio, frames) < 0) return -1;
 	}
 
 	return 0;
 }
 
-void close_output() {
-	if (output_type == 1) {
-		close_file_output();
+void close_output(struct output_t *out) {
+	if (out->type == 1) {
+		close_file_output(&out->file);
 	}
-	if (output_type == 2) {
+	if (out->type == 2) {
 		close_pulse_output();
 	}
 }
@@ -16,9 +16,20 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
 #include "file_output.h"
 #include "pulse_output.h"
 
-int open_output(char *output_name, unsigned int sample_rate, unsigned int channels);
-int write_output(short *audio, size_t frames);
-void close_output();
+// there is only one pulse output per process
+typedef struct output_t {
+	int type;
+	struct file_output_t file;
+} output_t;
+
+int open_output(struct output_t *out, char *output_name, unsigned int sample_rate, unsigned int channels);
+int write_output(struct output_t *out, short *audio, size_t frames);
+void close_output(struct output_t *out);
+
+#endif /* OUTPUT_H */
@@ -19,105 +19,404 @@
 #include "common.h"
 #include "rds.h"
 #include "rds_lib.h"
-#include "rds_modulator.h"
-
-// needed for clock time
-#include <time.h>
-
-static struct rds_params_t rds_data;
-
-// RDS data controls
-static struct {
-	uint8_t ps_update;
-	uint8_t rt_update;
-	uint8_t ab;
-	uint8_t rt_segments;
-	uint8_t rt_bursting;
-	uint8_t ptyn_update;
-} rds_state;
-
-// ODA
-#define MAX_ODAS 8
-static struct rds_oda_t odas[MAX_ODAS];
-static struct {
-	uint8_t current;
-	uint8_t count;
-} oda_state;
 
-// RT+
-static struct {
-	uint8_t group;
-	uint8_t running;
-	uint8_t toggle;
-	uint8_t type[2];
-	uint8_t start[2];
-	uint8_t len[2];
-} rtplus_cfg;
+static void count_change(struct rds_encoder_t *enc, uint64_t start,
+	uint32_t *changes, uint64_t *sum, uint32_t *max) {
+	uint32_t groups = enc->stats.groups + 1 - start;
+
+	(*changes)++;
+	*sum += groups;
+	if (groups > *max) *max = groups;
+}
+
+static void count_group(struct rds_encoder_t *enc, uint64_t *bits) {
+	// type and version from block B, cached groups only have it here
+	uint8_t type = (bits[0] >> 33) & 31;
+	uint32_t interval;
+
+	enc->stats.count[type]++;
+	if (enc->stats_state.next[type]) {
+		interval = enc->stats.groups + 1 - enc->stats_state.next[type];
+		enc->stats.interval_sum[type] += interval;
+		if (interval > enc->stats.interval_max[type])
+			enc->stats.interval_max[type] = interval;
+	}
+	enc->stats_state.next[type] = enc->stats.groups + 1;
+	enc->stats.groups++;
+
+	// the reader gets a copy from the next group if it is busy
+	if (pthread_mutex_trylock(&enc->stats_mutex) == 0) {
+		memcpy(&enc->published_stats, &enc->stats,
+			sizeof(struct rds_stats_t));
+		pthread_mutex_unlock(&enc->stats_mutex);
+	}
+}
 
-static void register_oda(uint8_t group, uint16_t aid, uint16_t scb) {
+void get_rds_stats(struct rds_encoder_t *enc, struct rds_stats_t *out) {
+	pthread_mutex_lock(&enc->stats_mutex);
+	memcpy(out, &enc->published_stats, sizeof(struct rds_stats_t));
+	pthread_mutex_unlock(&enc->stats_mutex);
+}
 
-	if (oda_state.count == MAX_ODAS) return; // can't accept more ODAs
+static inline void invalidate_group_cache(struct rds_group_cache_t *cache) {
+	cache->gen++;
+}
 
-	odas[oda_state.count].group = group;
-	odas[oda_state.count].aid = aid;
-	odas[oda_state.count].scb = scb;
-	oda_state.count++;
+static void invalidate_group_caches(struct rds_encoder_t *enc) {
+	invalidate_group_cache(&enc->ps_cache);
+	invalidate_group_cache(&enc->rt_cache);
+	invalidate_group_cache(&enc->ptyn_cache);
+	invalidate_group_cache(&enc->oda_cache);
 }
 
-/* Generates a CT (clock time) group if the minute has just changed
- * Returns 1 if the CT group was generated, 0 otherwise
+/* Select the cache entry for the group being generated
+ * Returns 1 if the entry is up to date and the blocks need not be built
  */
-static uint8_t get_rds_ct_group(uint16_t *blocks) {
-	static uint8_t latest_minutes;
+static uint8_t use_cached_group(struct rds_encoder_t *enc,
+	struct rds_group_cache_t *cache, uint8_t entry) {
+	enc->cached.group = &cache->groups[entry];
+	enc->cached.gen = cache->gen;
+	return enc->cached.group->gen == enc->cached.gen;
+}
 
-	// Check time
-	time_t now = time(NULL);
-	struct tm *utc = gmtime(&now);
+/* Start a batch of parameter changes. They go on air together once the
+ * outermost end_rds_update is called. Calls may be nested.
+ */
+void begin_rds_update(struct rds_encoder_t *enc) {
+	// recursive, only the holder touches the depth
+	pthread_mutex_lock(&enc->update_mutex);
+	enc->update_depth++;
+}
+
+void end_rds_update(struct rds_encoder_t *enc) {
+	if (--enc->update_depth == 0) {
+		// odd while the copy is in progress
+		__atomic_store_n(&enc->published_seq, enc->published_seq + 1,
+			__ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+		memcpy(&enc->published, &enc->pending,
+			sizeof(struct rds_snapshot_t));
+		__atomic_store_n(&enc->published_seq, enc->published_seq + 1,
+			__ATOMIC_RELEASE);
+	}
 
-	if (utc->tm_min != latest_minutes) {
-		// Generate CT group
-		latest_minutes = utc->tm_min;
+	pthread_mutex_unlock(&enc->update_mutex);
+}
 
-		uint8_t l = utc->tm_mon <= 1 ? 1 : 0;
-		uint16_t mjd = 14956 + utc->tm_mday +
-			(uint16_t)((utc->tm_year - l) * 365.25) +
-			(uint16_t)((utc->tm_mon + 2 + l*12) * 30.6001);
+/* Pick up the latest published parameters
+ * If an update is being published right now, the previous parameters are
+ * kept and the new ones are picked up on the next group.
+ */
+static void read_rds_snapshot(struct rds_encoder_t *enc) {
+	struct rds_snapshot_t *next = &enc->next;
+	struct rds_snapshot_t *rds = &enc->rds;
+	uint32_t seq = __atomic_load_n(&enc->published_seq, __ATOMIC_ACQUIRE);
+
+	if (seq == enc->rds_seq || (seq & 1)) return;
+
+	memcpy(next, &enc->published, sizeof(struct rds_snapshot_t));
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if (__atomic_load_n(&enc->published_seq, __ATOMIC_RELAXED) != seq) return;
+
+	// drop the cached groups that depend on changed fields
+	if (next->data.pi != rds->data.pi || next->data.pty != rds->data.pty ||
+		next->data.tp != rds->data.tp) {
+		invalidate_group_caches(enc);
+	} else if (next->data.ta != rds->data.ta ||
+		next->data.ms != rds->data.ms ||
+		next->data.di != rds->data.di) {
+		invalidate_group_cache(&enc->ps_cache);
+	}
+	if (next->num_odas != rds->num_odas ||
+		memcmp(next->odas, rds->odas, sizeof(next->odas))) {
+		invalidate_group_cache(&enc->oda_cache);
+	}
+
+	if (next->ps_version != rds->ps_version) {
+		enc->stats_state.ps_change = enc->stats.groups;
+		enc->stats_state.ps_pending = 1;
+	}
+	if (next->rt_version != rds->rt_version) {
+		enc->stats_state.rt_change = enc->stats.groups;
+		enc->stats_state.rt_pending = 1;
+	}
+
+	memcpy(rds, next, sizeof(struct rds_snapshot_t));
+	enc->rds_seq = seq;
+
+	if (rds->ab_version != enc->state.ab_version) {
+		enc->state.ab = rds->ab;
+		enc->state.ab_version = rds->ab_version;
+		invalidate_group_cache(&enc->rt_cache);
+	}
+	if (rds->rt_version != enc->state.rt_version)
+		enc->state.rt_bursting = rds->rt_segments;
+}
+
+/* Announce an ODA in 3A groups. An ODA already registered under the
+ * same AID is updated.
+ */
+int8_t set_rds_oda(struct rds_encoder_t *enc, uint8_t group, uint16_t aid,
+	uint16_t scb) {
+	struct rds_oda_t *oda;
+	uint8_t i;
+
+	begin_rds_update(enc);
+	for (i = 0; i < enc->pending.num_odas; i++) {
+		if (enc->pending.odas[i].aid == aid) break;
+	}
+	if (i == MAX_ODAS) {
+		end_rds_update(enc);
+		return -1; // can't accept more ODAs
+	}
+
+	oda = &enc->pending.odas[i];
+	memset(oda, 0, sizeof(struct rds_oda_t));
+	oda->group = group;
+	oda->aid = aid;
+	oda->scb = scb;
+	if (i == enc->pending.num_odas) enc->pending.num_odas++;
+	end_rds_update(enc);
+
+	return 0;
+}
+
+/*
+ * Clock time
+ *
+ * Time is kept by counting groups. Group n from the encoder starts on air
+ * n + 1 group periods after the first sample (the modulator starts with
+ * an empty group). The wall clock time of the first sample is taken from
+ * CLOCK_REALTIME and re-disciplined about once a minute against the bits
+ * the modulator has actually sent. The CT group is then placed on the
+ * group that starts closest to the minute edge.
+ */
+#define GROUP_PERIOD	((double)BITS_PER_GROUP * SAMPLES_PER_BIT / RDS_SAMPLE_RATE)
+#define BIT_RATE	((double)RDS_SAMPLE_RATE / SAMPLES_PER_BIT)
+// about a minute
+#define CT_DISCIPLINE_GROUPS	685
+
+/* Find the group that starts closest to the minute edge of next_minute
+ */
+static void place_ct_group(struct rds_encoder_t *enc) {
+	double groups = ceil((enc->ct_clock.next_minute - GROUP_PERIOD / 2 -
+		enc->ct_clock.epoch) / GROUP_PERIOD) - 1;
+
+	enc->ct_clock.next_ct_group = groups > enc->ct_clock.group ?
+		(uint64_t)groups : enc->ct_clock.group;
+}
+
+/* Pick the next minute edge after the start of the current group
+ */
+static void schedule_ct_group(struct rds_encoder_t *enc) {
+	double start = enc->ct_clock.epoch +
+		(enc->ct_clock.group + 1) * GROUP_PERIOD;
 
-		blocks[1] |= 4 << 12 | (mjd>>15);
-		blocks[2] = (mjd<<1) | (utc->tm_hour>>4);
-		blocks[3] = (utc->tm_hour & 0xF)<<12 | utc->tm_min<<6;
+	enc->ct_clock.next_minute = ((time_t)start / 60 + 1) * 60;
+	place_ct_group(enc);
+}
 
-		struct tm *local = localtime(&now);
+/* Returns 1 if the clock was stepped rather than followed */
+static uint8_t discipline_ct_clock(struct rds_encoder_t *enc) {
+	struct timespec now;
+	double epoch, error;
 
-		int8_t offset = local->tm_hour - utc->tm_hour;
-		blocks[3] |= abs(offset);
-		if (offset < 0) blocks[3] |= (1 << 5);
+	clock_gettime(CLOCK_REALTIME, &now);
+	epoch = now.tv_sec + now.tv_nsec / 1e9 + enc->rds.ct_latency -
+		__atomic_load_n(&enc->bits_sent, __ATOMIC_RELAXED) / BIT_RATE;
+	error = epoch - enc->ct_clock.epoch;
 
+	// follow slowly unless the clock was set
+	if (fabs(error) > 1.0) {
+		enc->ct_clock.epoch = epoch;
 		return 1;
 	}
 
+	enc->ct_clock.epoch += error / 4.0;
 	return 0;
 }
 
+/* Index of the group that starts closest to a wall clock time. Only
+ * valid on the encoder thread, e.g. from the group hook.
+ */
+uint64_t get_rds_group_at(struct rds_encoder_t *enc, double time) {
+	double groups = round((time - enc->ct_clock.epoch) / GROUP_PERIOD) - 1;
+
+	return groups > 0 ? (uint64_t)groups : 0;
+}
+
+/* Earliest wall clock time a command can be scheduled for without
+ * building groups again, see rewind_rds_encoder. Safe from any thread.
+ */
+double get_rds_build_time(struct rds_encoder_t *enc) {
+	double time;
+
+	__atomic_load(&enc->build_time, &time, __ATOMIC_RELAXED);
+	return time;
+}
+
+static void update_build_time(struct rds_encoder_t *enc) {
+	double time = enc->ct_clock.epoch +
+		(enc->ct_clock.group + 0.5) * GROUP_PERIOD;
+
+	__atomic_store(&enc->build_time, &time, __ATOMIC_RELAXED);
+}
+
+static void save_checkpoint(struct rds_encoder_t *enc) {
+	struct rds_checkpoint_t *cp = &enc->checkpoints[enc->ct_clock.group &
+		(RDS_CHECKPOINTS - 1)];
+
+	memcpy(&cp->rds, &enc->rds, sizeof(struct rds_snapshot_t));
+	cp->rds_seq = enc->rds_seq;
+	memcpy(&cp->state, &enc->state, sizeof(struct rds_encoder_state_t));
+	memcpy(&cp->stats, &enc->stats, sizeof(struct rds_stats_t));
+	memcpy(&cp->stats_state, &enc->stats_state,
+		sizeof(struct rds_stats_state_t));
+	memcpy(&cp->ct_clock, &enc->ct_clock, sizeof(struct rds_ct_clock_t));
+}
+
+/* Go back count groups, which were built but taken back before they went
+ * out, so they are built again from the current parameters. Groups
+ * built since a group hook last changed something can be taken back,
+ * older ones must go out as built.
+ *
+ * The encoder goes back to where it was before the oldest of them, so
+ * the text segments, CT group and statistics of the groups taken back
+ * are sent and counted again. The parameters published since are picked
+ * up on the next group as they were the first time.
+ */
+void rewind_rds_encoder(struct rds_encoder_t *enc, uint16_t count) {
+	struct rds_checkpoint_t *cp;
+
+	if (count > RDS_CHECKPOINTS) count = RDS_CHECKPOINTS;
+	if (count > enc->unchanged_groups) count = enc->unchanged_groups;
+	if (!count) return;
+
+	cp = &enc->checkpoints[(enc->ct_clock.group - count) &
+		(RDS_CHECKPOINTS - 1)];
+	memcpy(&enc->rds, &cp->rds, sizeof(struct rds_snapshot_t));
+	enc->rds_seq = cp->rds_seq;
+	memcpy(&enc->state, &cp->state, sizeof(struct rds_encoder_state_t));
+	memcpy(&enc->stats, &cp->stats, sizeof(struct rds_stats_t));
+	memcpy(&enc->stats_state, &cp->stats_state,
+		sizeof(struct rds_stats_state_t));
+	memcpy(&enc->ct_clock, &cp->ct_clock, sizeof(struct rds_ct_clock_t));
+	enc->unchanged_groups -= count;
+
+	// entries may have been encoded from text the groups moved on to
+	invalidate_group_caches(enc);
+	update_build_time(enc);
+}
+
+/* Account for a group sent without the modulator (group output) */
+void add_rds_group_sent(struct rds_encoder_t *enc) {
+	__atomic_store_n(&enc->bits_sent, enc->bits_sent + BITS_PER_GROUP,
+		__ATOMIC_RELAXED);
+}
+
+/* Called before each group is built, with its index. If one returns
+ * nonzero, parameters may have changed and are read again so they go
+ * out in this group.
+ */
+int8_t add_rds_group_hook(struct rds_encoder_t *enc,
+	uint8_t (*hook)(void *arg, uint64_t group), void *arg) {
+	struct rds_group_hook_t *h;
+
+	for (uint8_t i = 0; i < enc->num_group_hooks; i++) {
+		h = &enc->group_hooks[i];
+		if (h->run == hook && h->arg == arg) return 0;
+	}
+	if (enc->num_group_hooks == MAX_GROUP_HOOKS) return -1;
+
+	h = &enc->group_hooks[enc->num_group_hooks];
+	h->run = hook;
+	h->arg = arg;
+	__atomic_store_n(&enc->num_group_hooks, enc->num_group_hooks + 1,
+		__ATOMIC_RELEASE);
+
+	return 0;
+}
+
+static uint8_t run_group_hooks(struct rds_encoder_t *enc, uint64_t group) {
+	uint8_t n = __atomic_load_n(&enc->num_group_hooks, __ATOMIC_ACQUIRE);
+	uint8_t changed = 0;
+
+	for (uint8_t i = 0; i < n; i++) {
+		changed |= enc->group_hooks[i].run(enc->group_hooks[i].arg,
+			group);
+	}
+
+	return changed;
+}
+
+static void update_ct_clock(struct rds_encoder_t *enc) {
+	// the CT group of the last minute has been built
+	if (enc->ct_clock.group > enc->ct_clock.next_ct_group)
+		schedule_ct_group(enc);
+
+	/* The minute that is due stays due, only its group moves with the
+	 * clock. Picking the minute again could skip it when the CT group
+	 * is the one starting just after the minute edge.
+	 */
+	if (enc->ct_clock.group == enc->ct_clock.next_discipline) {
+		if (discipline_ct_clock(enc)) {
+			schedule_ct_group(enc);
+		} else {
+			place_ct_group(enc);
+		}
+		enc->ct_clock.next_discipline += CT_DISCIPLINE_GROUPS;
+	}
+}
+
+/* Generates a CT (clock time) group if this group starts the minute
+ * Returns 1 if the CT group was generated, 0 otherwise
+ */
+static uint8_t get_rds_ct_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct tm utc, local;
+
+	if (enc->ct_clock.group != enc->ct_clock.next_ct_group) return 0;
+
+	// Generate CT group
+	gmtime_r(&enc->ct_clock.next_minute, &utc);
+	localtime_r(&enc->ct_clock.next_minute, &local);
+
+	uint8_t l = utc.tm_mon <= 1 ? 1 : 0;
+	uint16_t mjd = 14956 + utc.tm_mday +
+		(uint16_t)((utc.tm_year - l) * 365.25) +
+		(uint16_t)((utc.tm_mon + 2 + l*12) * 30.6001);
+
+	blocks[1] |= 4 << 12 | (mjd>>15);
+	blocks[2] = (mjd<<1) | (utc.tm_hour>>4);
+	blocks[3] = (utc.tm_hour & 0xF)<<12 | utc.tm_min<<6;
+
+	// local time offset in half hours
+	int8_t offset = local.tm_gmtoff / 1800;
+	blocks[3] |= abs(offset);
+	if (offset < 0) blocks[3] |= (1 << 5);
+
+	return 1;
+}
+
 /* Get the next AF entry
  */
-static uint16_t get_next_af() {
-	static uint8_t af_state;
+static uint16_t get_next_af(struct rds_encoder_t *enc) {
+	struct rds_af_t *af = &enc->rds.data.af;
+	uint8_t *af_state = &enc->state.af_state;
 	uint16_t out;
 
-	if (rds_data.af.num_afs) {
-		if (af_state == 0) {
-			out = (rds_data.af.num_afs + 224) << 8 | rds_data.af.afs[0];
-			af_state += 1;
+	if (af->num_afs) {
+		if (*af_state == 0) {
+			out = (af->num_afs + 224) << 8 | af->afs[0];
+			*af_state += 1;
 		} else {
-			out = rds_data.af.afs[af_state] << 8;
-			if (rds_data.af.afs[af_state+1])
-				out |= rds_data.af.afs[af_state+1];
+			out = af->afs[*af_state] << 8;
+			if (af->afs[*af_state+1])
+				out |= af->afs[*af_state+1];
 			else
 				out |= 205; // filler
-			af_state += 2;
+			*af_state += 2;
 		}
-		if (af_state >= rds_data.af.num_entries) af_state = 0;
+		if (*af_state >= af->num_entries) *af_state = 0;
 	} else {
 		out = 224 << 8 | 205; // no AF
 	}
@@ -127,183 +426,369 @@ static uint16_t get_next_af() {
 
 /* PS group (0A)
  */
-static void get_rds_ps_group(uint16_t *blocks) {
-	static char ps_text[8];
-	static uint8_t ps_state;
+static void get_rds_ps_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
+	uint8_t ps_state = enc->state.ps_state;
+
+	if (ps_state == 0 && enc->state.ps_version != rds->ps_version) {
+		strncpy(enc->state.ps_text, rds->data.ps, PS_LENGTH);
+		enc->state.ps_version = rds->ps_version;
+		invalidate_group_cache(&enc->ps_cache);
+		enc->stats_state.ps_sent = 0;
+	}
 
-	if (ps_state == 0 && rds_state.ps_update) {
-		strncpy(ps_text, rds_data.ps, PS_LENGTH);
-		rds_state.ps_update = 0; // rewind
+	if (enc->stats_state.ps_sent) enc->stats.repeats++;
+	if (ps_state == 3) {
+		enc->stats_state.ps_sent = 1;
+		if (enc->stats_state.ps_pending &&
+			enc->state.ps_version == rds->ps_version) {
+			count_change(enc, enc->stats_state.ps_change,
+				&enc->stats.ps_changes, &enc->stats.ps_change_sum,
+				&enc->stats.ps_change_max);
+			enc->stats_state.ps_pending = 0;
+		}
 	}
 
-	// TA
-	blocks[1] |= (rds_data.ta & 1) << 4;
+	// AF
+	blocks[2] = get_next_af(enc);
+	enc->cached.af = 1;
 
-	// MS
-	blocks[1] |= (rds_data.ms & 1) << 3;
+	if (!use_cached_group(enc, &enc->ps_cache, ps_state)) {
+		// TA
+		blocks[1] |= (rds->data.ta & 1) << 4;
 
-	// DI
-	blocks[1] |= ((rds_data.di >> (3 - ps_state)) & 1) << 2;
+		// MS
+		blocks[1] |= (rds->data.ms & 1) << 3;
 
-	// PS segment address
-	blocks[1] |= (ps_state & 3);
+		// DI
+		blocks[1] |= ((rds->data.di >> (3 - ps_state)) & 1) << 2;
 
-	// AF
-	blocks[2] = get_next_af();
+		// PS segment address
+		blocks[1] |= (ps_state & 3);
 
-	// PS
-	blocks[3] = ps_text[ps_state*2] << 8 | ps_text[ps_state*2+1];
+		// PS
+		blocks[3] = enc->state.ps_text[ps_state*2] << 8 |
+			enc->state.ps_text[ps_state*2+1];
+	}
 
 	ps_state++;
 	if (ps_state == 4) ps_state = 0;
+	enc->state.ps_state = ps_state;
 }
 
 /* RT group (2A)
  */
-static void get_rds_rt_group(uint16_t *blocks) {
-	static char rt_text[RT_LENGTH];
-	static uint8_t rt_state;
+static void get_rds_rt_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
+	char *rt_text = enc->state.rt_text;
+	uint8_t rt_state = enc->state.rt_state;
 
-	if (rds_state.rt_bursting) rds_state.rt_bursting--;
+	if (enc->state.rt_bursting) enc->state.rt_bursting--;
 
-	if (rds_state.rt_update) {
-		strncpy(rt_text, rds_data.rt, RT_LENGTH);
-		rds_state.ab ^= 1;
-		rds_state.rt_update = 0;
+	if (enc->state.rt_version != rds->rt_version) {
+		strncpy(rt_text, rds->data.rt, RT_LENGTH);
+		enc->state.ab ^= 1;
+		enc->state.rt_version = rds->rt_version;
 		rt_state = 0; // rewind when new RT arrives
+		invalidate_group_cache(&enc->rt_cache);
+		enc->stats_state.rt_sent = 0;
 	}
 
-	blocks[1] |= 2 << 12 | rds_state.ab << 4 | rt_state;
-	blocks[2] = rt_text[rt_state*4+0] << 8 | rt_text[rt_state*4+1];
-	blocks[3] = rt_text[rt_state*4+2] << 8 | rt_text[rt_state*4+3];
+	if (enc->stats_state.rt_sent) enc->stats.repeats++;
+	if (rt_state == rds->rt_segments - 1) {
+		enc->stats_state.rt_sent = 1;
+		if (enc->stats_state.rt_pending) {
+			count_change(enc, enc->stats_state.rt_change,
+				&enc->stats.rt_changes, &enc->stats.rt_change_sum,
+				&enc->stats.rt_change_max);
+			enc->stats_state.rt_pending = 0;
+		}
+	}
+
+	if (!use_cached_group(enc, &enc->rt_cache, rt_state)) {
+		blocks[1] |= 2 << 12 | enc->state.ab << 4 | rt_state;
+		blocks[2] = rt_text[rt_state*4+0] << 8 | rt_text[rt_state*4+1];
+		blocks[3] = rt_text[rt_state*4+2] << 8 | rt_text[rt_state*4+3];
+	}
 
 	rt_state++;
-	if (rt_state == rds_state.rt_segments) rt_state = 0;
+	if (rt_state == rds->rt_segments) rt_state = 0;
+	enc->state.rt_state = rt_state;
 }
 
 /* ODA group (3A)
  */
-static void get_rds_oda_group(uint16_t *blocks) {
-	blocks[1] |= 3 << 12;
+static void get_rds_oda_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
+	uint8_t *current = &enc->state.oda_state;
+
+	// the ODA list may have shrunk
+	if (*current >= rds->num_odas) *current = 0;
 
 	// select ODA
-	rds_oda_t this_oda = odas[oda_state.current++];
+	rds_oda_t this_oda = rds->odas[*current];
+
+	if (!use_cached_group(enc, &enc->oda_cache, *current)) {
+		blocks[1] |= 3 << 12;
+		blocks[1] |= GET_GROUP_TYPE(this_oda.group) << 1 |
+			     GET_GROUP_VER(this_oda.group);
+		blocks[2] = this_oda.scb;
+		blocks[3] = this_oda.aid;
+	}
 
-	blocks[1] |= GET_GROUP_TYPE(this_oda.group) << 1 |
-		     GET_GROUP_VER(this_oda.group);
-	blocks[2] = this_oda.scb;
-	blocks[3] = this_oda.aid;
-	if (oda_state.current == oda_state.count) oda_state.current = 0;
+	(*current)++;
+	if (*current == rds->num_odas) *current = 0;
 }
 
 /* PTYN group (10A)
  */
-static void get_rds_ptyn_group(uint16_t *blocks) {
-	static char ptyn_text[8];
-	static uint8_t ptyn_state;
-
-	if (ptyn_state == 0 && rds_state.ptyn_update) {
-		strncpy(ptyn_text, rds_data.ptyn, PTYN_LENGTH);
-		rds_state.ptyn_update = 0;
+static void get_rds_ptyn_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
+	char *ptyn_text = enc->state.ptyn_text;
+	uint8_t ptyn_state = enc->state.ptyn_state;
+
+	if (ptyn_state == 0 && enc->state.ptyn_version != rds->ptyn_version) {
+		strncpy(ptyn_text, rds->data.ptyn, PTYN_LENGTH);
+		enc->state.ptyn_version = rds->ptyn_version;
+		invalidate_group_cache(&enc->ptyn_cache);
 	}
 
-	blocks[1] |= 10 << 12 | ptyn_state;
-	blocks[2] = ptyn_text[ptyn_state*4+0] << 8 | ptyn_text[ptyn_state*4+1];
-	blocks[3] = ptyn_text[ptyn_state*4+2] << 8 | ptyn_text[ptyn_state*4+3];
+	if (!use_cached_group(enc, &enc->ptyn_cache, ptyn_state)) {
+		blocks[1] |= 10 << 12 | ptyn_state;
+		blocks[2] = ptyn_text[ptyn_state*4+0] << 8 | ptyn_text[ptyn_state*4+1];
+		blocks[3] = ptyn_text[ptyn_state*4+2] << 8 | ptyn_text[ptyn_state*4+3];
+	}
 
 	ptyn_state++;
 	if (ptyn_state == 2) ptyn_state = 0;
+	enc->state.ptyn_state = ptyn_state;
 }
 
 // RT+
-static void init_rtplus(uint8_t group) {
-	register_oda(group, 0x4BD7 /* RT+ AID */, 0);
-	rtplus_cfg.group = group;
+static void init_rtplus(struct rds_encoder_t *enc, uint8_t group) {
+	set_rds_oda(enc, group, 0x4BD7 /* RT+ AID */, 0);
+	begin_rds_update(enc);
+	enc->pending.rtplus.group = group;
+	end_rds_update(enc);
 }
 
 /* RT+ group
  */
-static void get_rds_rtplus_group(uint16_t *blocks) {
+static void get_rds_rtplus_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
+
 	// RT+ block format
-	blocks[1] |= GET_GROUP_TYPE(rtplus_cfg.group) << 12 |
-		     GET_GROUP_VER(rtplus_cfg.group) << 11 |
-		     rtplus_cfg.toggle << 4 | rtplus_cfg.running << 3 |
-		    (rtplus_cfg.type[0]  & BIT_U5) >> 3;
-	blocks[2] = (rtplus_cfg.type[0]  & BIT_L3) << 13 |
-		    (rtplus_cfg.start[0] & BIT_L6) << 7 |
-		    (rtplus_cfg.len[0]   & BIT_L6) << 1 |
-		    (rtplus_cfg.type[1]  & BIT_U3) >> 5;
-	blocks[3] = (rtplus_cfg.type[1]  & BIT_L5) << 11 |
-		    (rtplus_cfg.start[1] & BIT_L6) << 5 |
-		    (rtplus_cfg.len[1]   & BIT_L5);
-}
-
-/* Lower priority groups are placed in a subsequence
+	blocks[1] |= GET_GROUP_TYPE(rds->rtplus.group) << 12 |
+		     GET_GROUP_VER(rds->rtplus.group) << 11 |
+		     rds->rtplus.toggle << 4 | rds->rtplus.running << 3 |
+		    (rds->rtplus.type[0]  & BIT_U5) >> 3;
+	blocks[2] = (rds->rtplus.type[0]  & BIT_L3) << 13 |
+		    (rds->rtplus.start[0] & BIT_L6) << 7 |
+		    (rds->rtplus.len[0]   & BIT_L6) << 1 |
+		    (rds->rtplus.type[1]  & BIT_U3) >> 5;
+	blocks[3] = (rds->rtplus.type[1]  & BIT_L5) << 11 |
+		    (rds->rtplus.start[1] & BIT_L6) << 5 |
+		    (rds->rtplus.len[1]   & BIT_L5);
+}
+
+/*
+ * Group scheduler
+ *
+ * Every group type with something to send earns credit in proportion
+ * to its target rate on each slot. The one with the most credit gets
+ * the slot and pays back the credit earned by all of them (smooth
+ * weighted round-robin). Types with nothing to send neither earn
+ * credit nor take up slots.
  */
-static uint8_t get_rds_other_groups(uint16_t *blocks) {
-	static uint8_t group[15];
-	uint8_t group_coded = 0;
-
-	// Type 3A groups
-	if (++group[3] == 20) {
-		group[3] = 0;
-		get_rds_oda_group(blocks);
-		group_coded = 1;
-	}
-
-	// Type 10A groups
-	if (!group_coded && ++group[10] == 10) {
-		group[10] = 0;
-		if (rds_data.ptyn[0]) {
-			// Do not generate a 10A group if PTYN is off
-			get_rds_ptyn_group(blocks);
-			group_coded = 1;
+static uint8_t ps_ready(struct rds_snapshot_t *rds) {
+	(void)rds;
+	return 1;
+}
+
+static uint8_t rt_ready(struct rds_snapshot_t *rds) {
+	return rds->rt_segments != 0;
+}
+
+static uint8_t oda_ready(struct rds_snapshot_t *rds) {
+	return rds->num_odas != 0;
+}
+
+static uint8_t ptyn_ready(struct rds_snapshot_t *rds) {
+	// Do not generate a 10A group if PTYN is off
+	return rds->data.ptyn[0] != 0;
+}
+
+static uint8_t rtplus_ready(struct rds_snapshot_t *rds) {
+	return rds->rtplus.running;
+}
+
+typedef struct rds_group_source_t {
+	uint8_t group;
+	uint8_t (*ready)(struct rds_snapshot_t *rds);
+	void (*get_group)(struct rds_encoder_t *enc, uint16_t *blocks);
+} rds_group_source_t;
+
+/* Rates are in rds_snapshot_t.group_rates and credits in the encoder
+ * state, in the same order. The table itself is shared by all encoders.
+ */
+static const struct rds_group_source_t group_sources[NUM_GROUP_SOURCES] = {
+	{GROUP_0A,  ps_ready,     get_rds_ps_group},
+	{GROUP_2A,  rt_ready,     get_rds_rt_group},
+	{GROUP_3A,  oda_ready,    get_rds_oda_group},
+	{GROUP_10A, ptyn_ready,   get_rds_ptyn_group},
+	{GROUP_11A, rtplus_ready, get_rds_rtplus_group}
+};
+
+static const struct rds_group_source_t *get_next_source(
+	struct rds_encoder_t *enc) {
+	int32_t *credit = enc->state.credit;
+	int8_t next = -1;
+	int32_t total = 0;
+	uint8_t others = 0;
+
+	for (uint8_t i = 0; i < NUM_GROUP_SOURCES; i++) {
+		uint16_t rate = enc->rds.group_rates[i];
+		if (!rate || !group_sources[i].ready(&enc->rds)) {
+			credit[i] = 0;
+			continue;
 		}
+		credit[i] += rate;
+		total += rate;
+		if (i) others++;
+		if (next == -1 || credit[i] > credit[next]) next = i;
 	}
 
-	// Type 11A groups
-	if (!group_coded && ++group[rtplus_cfg.group] == 20) {
-		group[rtplus_cfg.group] = 0;
-		get_rds_rtplus_group(blocks);
-		group_coded = 1;
-	}
+	/* A PS group is filler when no other type had anything to send,
+	 * so PS took the slot whatever its own rate. PS is also the
+	 * fallback if everything has been turned off.
+	 */
+	if (!others) enc->stats.filler++;
+	if (next == -1) return &group_sources[0];
 
-	return group_coded;
+	credit[next] -= total;
+	return &group_sources[next];
 }
 
 /* Creates an RDS group.
- * This generates sequences of the form 0A, 2A, 0A, 2A, 0A, 2A, etc.
+ * CT goes out at the minute edge and a new RT is sent in one go.
+ * All other slots are handed out by the group scheduler.
  */
-static void get_rds_group(uint16_t *blocks) {
-	static uint8_t state;
+static void get_rds_group(struct rds_encoder_t *enc, uint16_t *blocks) {
+	struct rds_snapshot_t *rds = &enc->rds;
 
 	// Basic block data
-	blocks[0] = rds_data.pi;
-	blocks[1] = (rds_data.tp & 1) << 10 | (rds_data.pty & 31) << 5;
+	blocks[0] = rds->data.pi;
+	blocks[1] = (rds->data.tp & 1) << 10 | (rds->data.pty & 31) << 5;
 	blocks[2] = 0;
 	blocks[3] = 0;
 
 	// Generate block content
 	// CT (clock time) has priority on other group types
-	if (!(rds_data.tx_ctime && get_rds_ct_group(blocks))) {
-		if (!get_rds_other_groups(blocks)) { // Other groups
-			// These are always transmitted
-			if (!state) { // Type 0A groups
-				get_rds_ps_group(blocks);
-				state++;
-			} else { // Type 2A groups
-				get_rds_rt_group(blocks);
-				if (!rds_state.rt_bursting) state++;
-			}
-			if (state == 2) state = 0;
+	if (rds->data.tx_ctime && get_rds_ct_group(enc, blocks)) return;
+
+	// unless 2A is turned off
+	if (enc->state.rt_bursting && rds->group_rates[1]) {
+		get_rds_rt_group(enc, blocks);
+		return;
+	}
+
+	get_next_source(enc)->get_group(enc, blocks);
+}
+
+/* Parse a list of group rates such as "0A=4.5,2A=4.5,10A=0"
+ * Rates are in groups per second
+ */
+int8_t set_rds_group_rates(struct rds_encoder_t *enc, char *rates) {
+	uint16_t new_rates[NUM_GROUP_SOURCES];
+	char list[64];
+	char *item, *saveptr;
+	uint8_t type;
+	char ver;
+	float rate;
+	uint8_t i;
+
+	begin_rds_update(enc);
+	for (i = 0; i < NUM_GROUP_SOURCES; i++)
+		new_rates[i] = enc->pending.group_rates[i];
+	end_rds_update(enc);
+
+	strncpy(list, rates, 63);
+	list[63] = 0;
+
+	for (item = strtok_r(list, ",", &saveptr); item != NULL;
+		item = strtok_r(NULL, ",", &saveptr)) {
+		if (sscanf(item, "%hhu%c=%f", &type, &ver, &rate) != 3 ||
+			type > 15 || (ver != 'A' && ver != 'B') ||
+			rate < 0.0f || rate > 11.4f) {
+			fprintf(stderr, "Invalid group rate \"%s\".\n", item);
+			return -1;
+		}
+
+		for (i = 0; i < NUM_GROUP_SOURCES; i++) {
+			if (group_sources[i].group ==
+				(type << 4 | (ver == 'B' ? GROUP_VER_B : GROUP_VER_A)))
+				break;
+		}
+		if (i == NUM_GROUP_SOURCES) {
+			fprintf(stderr, "Group %u%c is not scheduled.\n", type, ver);
+			return -1;
 		}
+		new_rates[i] = lroundf(rate * 10.0f);
 	}
+
+	begin_rds_update(enc);
+	for (i = 0; i < NUM_GROUP_SOURCES; i++)
+		enc->pending.group_rates[i] = new_rates[i];
+	end_rds_update(enc);
+
+	return 0;
 }
 
-void get_rds_bits(uint8_t *bits) {
-	static uint16_t out_blocks[GROUP_LENGTH];
-	get_rds_group(out_blocks);
-	add_checkwords(out_blocks, bits);
+static void show_group_rates(uint16_t *rates) {
+	fprintf(stderr, "Group rates:");
+	for (uint8_t i = 0; i < NUM_GROUP_SOURCES; i++) {
+		fprintf(stderr, " %u%c=%.1f",
+			GET_GROUP_TYPE(group_sources[i].group),
+			GET_GROUP_VER(group_sources[i].group) ? 'B' : 'A',
+			rates[i] / 10.0f);
+	}
+	fprintf(stderr, "\n");
+}
+
+void get_rds_bits(struct rds_encoder_t *enc, uint64_t *bits) {
+	uint16_t out_blocks[GROUP_LENGTH];
+	struct rds_cached_group_t *cached;
+
+	save_checkpoint(enc);
+	read_rds_snapshot(enc);
+	update_ct_clock(enc);
+	if (run_group_hooks(enc, enc->ct_clock.group)) {
+		read_rds_snapshot(enc);
+		enc->unchanged_groups = 0;
+	} else if (enc->unchanged_groups < UINT32_MAX) {
+		enc->unchanged_groups++;
+	}
+
+	enc->cached.group = NULL;
+	enc->cached.af = 0;
+	get_rds_group(enc, out_blocks);
+
+	cached = enc->cached.group;
+	if (cached && cached->gen == enc->cached.gen) {
+		memcpy(bits, cached->bits, GROUP_WORDS * sizeof(uint64_t));
+		if (enc->cached.af) update_checkword(bits, 2, out_blocks[2]);
+	} else {
+		add_checkwords(out_blocks, bits);
+
+		if (cached) {
+			memcpy(cached->bits, bits, GROUP_WORDS * sizeof(uint64_t));
+			cached->gen = enc->cached.gen;
+		}
+	}
+
+	count_group(enc, bits);
+	enc->ct_clock.group++;
+	update_build_time(enc);
 }
 
 static void show_af_list(struct rds_af_t af_list) {
@@ -338,9 +823,41 @@ static void show_af_list(struct rds_af_t af_list) {
 	fprintf(stderr, "\n");
 }
 
-void init_rds_encoder(struct rds_params_t rds_params, char *call_sign) {
-	enum rds_pty_regions region = REGION_FCC;
+/* Set up an encoder with the defaults. The encoder must not be running. */
+void init_rds_encoder(struct rds_encoder_t *enc) {
+	pthread_mutexattr_t attr;
+
+	memset(enc, 0, sizeof(struct rds_encoder_t));
+
+	// setters call each other within an update
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&enc->update_mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	pthread_mutex_init(&enc->stats_mutex, NULL);
+
+	enc->ps_cache.gen = 1;
+	enc->rt_cache.gen = 1;
+	enc->ptyn_cache.gen = 1;
+	enc->oda_cache.gen = 1;
+
+	enc->pending.group_rates[0] = 45;
+	enc->pending.group_rates[1] = 45;
+	enc->pending.group_rates[2] = 5;
+	enc->pending.group_rates[3] = 10;
+	enc->pending.group_rates[4] = 5;
 
+	set_rds_ab(enc, 1);
+	set_rds_ct(enc, 1);
+	set_rds_ms(enc, 1);
+	set_rds_di(enc, DI_STEREO);
+
+	// Assign the RT+ AID to group 11A
+	init_rtplus(enc, GROUP_11A);
+}
+
+void set_rds_params(struct rds_encoder_t *enc, struct rds_params_t rds_params,
+	char *call_sign) {
 	if (rds_params.pty > 31) {
 		fprintf(stderr, "PTY must be between 0-31.\n");
 		rds_params.pty = 0;
@@ -356,97 +873,111 @@ void init_rds_encoder(struct rds_params_t rds_params, char *call_sign) {
 		}
 	}
 
-	fprintf(stderr, "RDS Options:\n");
-	fprintf(stderr, "PI: %04X, PS: \"%s\", PTY: %d (%s), TP: %d\n",
-		rds_params.pi,
-		rds_params.ps,
-		rds_params.pty,
-		get_pty(region, rds_params.pty),
-		rds_params.tp);
-	fprintf(stderr, "RT: \"%s\"\n", rds_params.rt);
-
-	// AF
-	if (rds_params.af.num_afs) {
-		set_rds_af(rds_params.af);
-		show_af_list(rds_params.af);
-	}
-
-	set_rds_pi(rds_params.pi);
-	set_rds_ps(rds_params.ps);
-	set_rds_ab(1);
-	set_rds_rt(rds_params.rt);
-	set_rds_pty(rds_params.pty);
-	if (rds_params.ptyn[0]) {
-		fprintf(stderr, "PTYN: \"%s\"\n", rds_params.ptyn);
-		set_rds_ptyn(rds_params.ptyn);
-	}
-	set_rds_tp(rds_params.tp);
-	set_rds_ct(1);
-	set_rds_ms(1);
-	set_rds_di(DI_STEREO);
-
-	// Assign the RT+ AID to group 11A
-	init_rtplus(GROUP_11A);
-
-	// initialize signal
-	init_symbol_waveforms();
+	begin_rds_update(enc);
+	if (rds_params.af.num_afs) set_rds_af(enc, rds_params.af);
+	set_rds_pi(enc, rds_params.pi);
+	set_rds_ps(enc, rds_params.ps);
+	set_rds_rt(enc, rds_params.rt);
+	set_rds_pty(enc, rds_params.pty);
+	if (rds_params.ptyn[0]) set_rds_ptyn(enc, rds_params.ptyn);
+	set_rds_tp(enc, rds_params.tp);
+	end_rds_update(enc);
 }
 
-void exit_rds_encoder() {
-	exit_symbol_waveforms();
+void show_rds_params(struct rds_encoder_t *enc) {
+	enum rds_pty_regions region = REGION_FCC;
+	struct rds_snapshot_t params;
+	char ps[PS_LENGTH + 1] = {0};
+	char rt[RT_LENGTH + 1] = {0};
+	char ptyn[PTYN_LENGTH + 1] = {0};
+
+	begin_rds_update(enc);
+	memcpy(&params, &enc->pending, sizeof(struct rds_snapshot_t));
+	end_rds_update(enc);
+
+	memcpy(ps, params.data.ps, PS_LENGTH);
+	memcpy(rt, params.data.rt, RT_LENGTH);
+	memcpy(ptyn, params.data.ptyn, PTYN_LENGTH);
+	// drop the terminator and the padding
+	rt[strcspn(rt, "\r")] = 0;
+	for (int8_t i = PS_LENGTH - 1; i >= 0 && ps[i] == ' '; i--) ps[i] = 0;
+	for (int8_t i = PTYN_LENGTH - 1; i >= 0 && ptyn[i] == ' '; i--) ptyn[i] = 0;
+
+	fprintf(stderr, "RDS Options:\n");
+	fprintf(stderr, "PI: %04X, PS: \"%s\", PTY: %d (%s), TP: %d\n",
+		params.data.pi,
+		ps,
+		params.data.pty,
+		get_pty(region, params.data.pty),
+		params.data.tp);
+	fprintf(stderr, "RT: \"%s\"\n", rt);
+	show_group_rates(params.group_rates);
+	if (params.data.af.num_afs) show_af_list(params.data.af);
+	if (ptyn[0]) fprintf(stderr, "PTYN: \"%s\"\n", ptyn);
 }
 
-void set_rds_pi(uint16_t pi_code) {
-	rds_data.pi = pi_code;
+void set_rds_pi(struct rds_encoder_t *enc, uint16_t pi_code) {
+	begin_rds_update(enc);
+	enc->pending.data.pi = pi_code;
+	end_rds_update(enc);
 }
 
-void set_rds_rt(char *rt) {
+void set_rds_rt(struct rds_encoder_t *enc, char *rt) {
+	struct rds_snapshot_t *pending = &enc->pending;
 	uint8_t rt_len = strlen(rt);
-	rds_state.rt_update = 1;
-	memset(rds_data.rt, 0, RT_LENGTH);
-	memcpy(rds_data.rt, rt, rt_len);
+
+	begin_rds_update(enc);
+	pending->rt_version++;
+	memset(pending->data.rt, 0, RT_LENGTH);
+	memcpy(pending->data.rt, rt, rt_len);
 
 	if (rt_len < RT_LENGTH) {
 		/* Terminate RT with '\r' (carriage return) if RT
 		 * is < 64 characters long
 		 */
-		rds_data.rt[rt_len++] = '\r';
+		pending->data.rt[rt_len++] = '\r';
 
 		for (int i = 0; i < RT_LENGTH + 1; i += 4) {
 			if (i >= rt_len) {
-				rds_state.rt_segments = i / 4;
+				pending->rt_segments = i / 4;
 				break;
 			}
 			// We have reached the end of the text string
 		}
 	} else {
 		// Default to 16 if RT is 64 characters long
-		rds_state.rt_segments = 16;
+		pending->rt_segments = 16;
 	}
-
-	rds_state.rt_bursting = rds_state.rt_segments;
+	end_rds_update(enc);
 }
 
-void set_rds_ps(char *ps) {
-	rds_state.ps_update = 1;
-	memset(rds_data.ps, ' ', PS_LENGTH);
-	memcpy(rds_data.ps, ps, strlen(ps));
+void set_rds_ps(struct rds_encoder_t *enc, char *ps) {
+	begin_rds_update(enc);
+	enc->pending.ps_version++;
+	memset(enc->pending.data.ps, ' ', PS_LENGTH);
+	memcpy(enc->pending.data.ps, ps, strlen(ps));
+	end_rds_update(enc);
 }
 
-void set_rds_rtplus_flags(uint8_t running, uint8_t toggle) {
+void set_rds_rtplus_flags(struct rds_encoder_t *enc, uint8_t running,
+	uint8_t toggle) {
 	if (running > 1) running = 1;
 	if (toggle > 1) toggle = 1;
-	rtplus_cfg.running = running;
-	rtplus_cfg.toggle = toggle;
+	begin_rds_update(enc);
+	enc->pending.rtplus.running = running;
+	enc->pending.rtplus.toggle = toggle;
+	end_rds_update(enc);
 }
 
-void set_rds_rtplus_tags(uint8_t *tags) {
-	rtplus_cfg.type[0]	= (tags[0] < 63) ? tags[0] : 0;
-	rtplus_cfg.start[0]	= (tags[1] < 64) ? tags[1] : 0;
-	rtplus_cfg.len[0]	= (tags[2] < 63) ? tags[2] : 0;
-	rtplus_cfg.type[1]	= (tags[3] < 63) ? tags[3] : 0;
-	rtplus_cfg.start[1]	= (tags[4] < 64) ? tags[4] : 0;
-	rtplus_cfg.len[1]	= (tags[5] < 32) ? tags[5] : 0;
+void set_rds_rtplus_tags(struct rds_encoder_t *enc, uint8_t *tags) {
+	begin_rds_update(enc);
+	enc->pending.rtplus.type[0]	= (tags[0] < 63) ? tags[0] : 0;
+	enc->pending.rtplus.start[0]	= (tags[1] < 64) ? tags[1] : 0;
+	enc->pending.rtplus.len[0]	= (tags[2] < 63) ? tags[2] : 0;
+	enc->pending.rtplus.type[1]	= (tags[3] < 63) ? tags[3] : 0;
+	enc->pending.rtplus.start[1]	= (tags[4] < 64) ? tags[4] : 0;
+	enc->pending.rtplus.len[1]	= (tags[5] < 32) ? tags[5] : 0;
+	end_rds_update(enc);
 }
 
 /*
@@ -487,48 +1018,75 @@ int8_t add_rds_af(struct rds_af_t *af_list, float freq) {
 	return 1;
 }
 
-void set_rds_af(struct rds_af_t new_af_list) {
-	memcpy(&rds_data.af, &new_af_list, sizeof(struct rds_af_t));
+void set_rds_af(struct rds_encoder_t *enc, struct rds_af_t new_af_list) {
+	begin_rds_update(enc);
+	memcpy(&enc->pending.data.af, &new_af_list, sizeof(struct rds_af_t));
+	end_rds_update(enc);
 }
 
-void clear_rds_af() {
-	memset(&rds_data.af, 0, sizeof(struct rds_af_t));
+void clear_rds_af(struct rds_encoder_t *enc) {
+	begin_rds_update(enc);
+	memset(&enc->pending.data.af, 0, sizeof(struct rds_af_t));
+	end_rds_update(enc);
 }
 
-void set_rds_pty(uint8_t pty) {
-	rds_data.pty = pty;
+void set_rds_pty(struct rds_encoder_t *enc, uint8_t pty) {
+	begin_rds_update(enc);
+	enc->pending.data.pty = pty;
+	end_rds_update(enc);
 }
 
-void set_rds_ptyn(char *ptyn) {
-	rds_state.ptyn_update = 1;
+void set_rds_ptyn(struct rds_encoder_t *enc, char *ptyn) {
+	begin_rds_update(enc);
+	enc->pending.ptyn_version++;
 	if (ptyn[0]) {
-		memset(rds_data.ptyn, ' ', PTYN_LENGTH);
-		memcpy(rds_data.ptyn, ptyn, strlen(ptyn));
+		memset(enc->pending.data.ptyn, ' ', PTYN_LENGTH);
+		memcpy(enc->pending.data.ptyn, ptyn, strlen(ptyn));
 	} else {
-		memset(rds_data.ptyn, 0, PTYN_LENGTH);
+		memset(enc->pending.data.ptyn, 0, PTYN_LENGTH);
 	}
+	end_rds_update(enc);
+}
+
+void set_rds_ta(struct rds_encoder_t *enc, uint8_t ta) {
+	begin_rds_update(enc);
+	enc->pending.data.ta = ta;
+	end_rds_update(enc);
 }
 
-void set_rds_ta(uint8_t ta) {
-	rds_data.ta = ta;
+void set_rds_tp(struct rds_encoder_t *enc, uint8_t tp) {
+	begin_rds_update(enc);
+	enc->pending.data.tp = tp;
+	end_rds_update(enc);
 }
 
-void set_rds_tp(uint8_t tp) {
-	rds_data.tp = tp;
+void set_rds_ms(struct rds_encoder_t *enc, uint8_t ms) {
+	begin_rds_update(enc);
+	enc->pending.data.ms = ms;
+	end_rds_update(enc);
 }
 
-void set_rds_ms(uint8_t ms) {
-	rds_data.ms = ms;
+void set_rds_ab(struct rds_encoder_t *enc, uint8_t ab) {
+	begin_rds_update(enc);
+	enc->pending.ab_version++;
+	enc->pending.ab = ab;
+	end_rds_update(enc);
 }
 
-void set_rds_ab(uint8_t ab) {
-	rds_state.ab = ab;
+void set_rds_di(struct rds_encoder_t *enc, uint8_t di) {
+	begin_rds_update(enc);
+	enc->pending.data.di = di;
+	end_rds_update(enc);
 }
 
-void set_rds_di(uint8_t di) {
-	rds_data.di = di;
+void set_rds_ct(struct rds_encoder_t *enc, uint8_t ct) {
+	begin_rds_update(enc);
+	enc->pending.data.tx_ctime = ct;
+	end_rds_update(enc);
 }
 
-void set_rds_ct(uint8_t ct) {
-	rds_data.tx_ctime = ct;
+void set_rds_ct_latency(struct rds_encoder_t *enc, float latency) {
+	begin_rds_update(enc);
+	enc->pending.ct_latency = latency;
+	end_rds_update(enc);
 }
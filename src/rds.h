@@ -19,6 +19,9 @@
 #ifndef RDS_H
 #define RDS_H
 
+#include <pthread.h>
+#include <time.h>
+
 /* The RDS error-detection code generator polynomial is
    x^10 + x^8 + x^7 + x^5 + x^4 + x^3 + x^0
 */
@@ -29,10 +32,13 @@
 
 #define GROUP_LENGTH		4
 #define BITS_PER_GROUP		(GROUP_LENGTH * (BLOCK_SIZE+POLY_DEG))
+// encoded groups are packed into two 64-bit words
+#define GROUP_WORDS		2
 #define RDS_SAMPLE_RATE		190000
 #define SAMPLES_PER_BIT		160
+// groups per second
+#define RDS_GROUP_RATE		11.4f
 #define FILTER_SIZE		1120
-#define SAMPLE_BUFFER_SIZE	(SAMPLES_PER_BIT + FILTER_SIZE)
 
 /* Text items
  *
@@ -196,23 +202,252 @@ enum rds_pty_regions {
 	REGION_ROW  // Rest of the world
 };
 
-extern void init_rds_encoder(struct rds_params_t rds_params, char *call_sign);
-extern void get_rds_bits(uint8_t *bits);
-extern void set_rds_pi(uint16_t pi_code);
-extern void set_rds_rt(char *rt);
-extern void set_rds_ps(char *ps);
-extern void set_rds_rtplus_flags(uint8_t running, uint8_t toggle);
-extern void set_rds_rtplus_tags(uint8_t *tags);
-extern void set_rds_ta(uint8_t ta);
-extern void set_rds_pty(uint8_t pty);
-extern void set_rds_ptyn(char *ptyn);
-extern void set_rds_af(struct rds_af_t new_af_list);
+/* Channel statistics, counted by the encoder */
+#define NUM_GROUP_TYPES	32
+
+typedef struct rds_stats_t {
+	// groups built
+	uint64_t groups;
+	// per group type, indexed by type << 1 | version
+	uint32_t count[NUM_GROUP_TYPES];
+	// groups from one group of a type to the next
+	uint64_t interval_sum[NUM_GROUP_TYPES];
+	uint32_t interval_max[NUM_GROUP_TYPES];
+	// PS and RT changes and the groups each took until fully sent
+	uint32_t ps_changes;
+	uint64_t ps_change_sum;
+	uint32_t ps_change_max;
+	uint32_t rt_changes;
+	uint64_t rt_change_sum;
+	uint32_t rt_change_max;
+	// PS groups sent because no other type had anything to send
+	uint32_t filler;
+	// PS and RT groups repeating text that was already sent in full
+	uint32_t repeats;
+} rds_stats_t;
+
+#define NUM_GROUP_SOURCES	5
+#define MAX_ODAS		8
+#define MAX_GROUP_HOOKS		4
+
+/* RDS parameter snapshot
+ *
+ * Everything the control side can change lives here. Setters edit a
+ * pending copy under a mutex and publish it through a sequence lock.
+ * The encoder picks up the latest published copy once per group without
+ * locking, so a group never mixes old and new values.
+ */
+typedef struct rds_snapshot_t {
+	struct rds_params_t data;
+	uint8_t rt_segments;
+	uint8_t ab;
+	// bumped every time the item is set
+	uint32_t ps_version;
+	uint32_t rt_version;
+	uint32_t ptyn_version;
+	uint32_t ab_version;
+	// delay from the modulator to the output in seconds
+	float ct_latency;
+	// RT+
+	struct {
+		uint8_t group;
+		uint8_t running;
+		uint8_t toggle;
+		uint8_t type[2];
+		uint8_t start[2];
+		uint8_t len[2];
+	} rtplus;
+	// target rates in tenths of groups per second
+	uint16_t group_rates[NUM_GROUP_SOURCES];
+	// ODAs announced in 3A groups
+	struct rds_oda_t odas[MAX_ODAS];
+	uint8_t num_odas;
+} rds_snapshot_t;
+
+/* Encoded group cache
+ *
+ * PS, RT, PTYN and ODA groups only change when their content does, so
+ * they are encoded once per segment and reused. Each cache has its own
+ * generation which is bumped whenever a field used by its groups is
+ * updated. Entries encoded under an older generation are stale.
+ */
+typedef struct rds_cached_group_t {
+	uint32_t gen;
+	uint64_t bits[GROUP_WORDS];
+} rds_cached_group_t;
+
+typedef struct rds_group_cache_t {
+	uint32_t gen;
+	struct rds_cached_group_t groups[16];
+} rds_group_cache_t;
+
+/* Called before each group is built, with its index */
+typedef struct rds_group_hook_t {
+	uint8_t (*run)(void *arg, uint64_t group);
+	void *arg;
+} rds_group_hook_t;
+
+/* Encoder state */
+typedef struct rds_encoder_state_t {
+	// last versions picked up
+	uint32_t ps_version;
+	uint32_t rt_version;
+	uint32_t ptyn_version;
+	uint32_t ab_version;
+	uint8_t ab;
+	uint8_t rt_bursting;
+	// text being sent and the next segment
+	char ps_text[PS_LENGTH];
+	uint8_t ps_state;
+	char rt_text[RT_LENGTH];
+	uint8_t rt_state;
+	char ptyn_text[PTYN_LENGTH];
+	uint8_t ptyn_state;
+	uint8_t af_state;
+	uint8_t oda_state;
+	// group scheduler credit of each source
+	int32_t credit[NUM_GROUP_SOURCES];
+} rds_encoder_state_t;
+
+/* What the statistics keep between groups */
+typedef struct rds_stats_state_t {
+	// group after the last one of each type, 0 if none yet
+	uint64_t next[NUM_GROUP_TYPES];
+	// group a text change was picked up in
+	uint64_t ps_change;
+	uint64_t rt_change;
+	uint8_t ps_pending;
+	uint8_t rt_pending;
+	// current text sent in full at least once
+	uint8_t ps_sent;
+	uint8_t rt_sent;
+} rds_stats_state_t;
+
+/* Clock time */
+typedef struct rds_ct_clock_t {
+	// wall clock time of the first sample on air
+	double epoch;
+	// index of the group being generated
+	uint64_t group;
+	uint64_t next_ct_group;
+	uint64_t next_discipline;
+	time_t next_minute;
+} rds_ct_clock_t;
+
+/* Everything a group was built from, saved before each group so the
+ * groups can be taken back and built again, see rewind_rds_encoder
+ */
+#define RDS_CHECKPOINTS		16 /* must be a power of 2 */
+
+typedef struct rds_checkpoint_t {
+	struct rds_snapshot_t rds;
+	uint32_t rds_seq;
+	struct rds_encoder_state_t state;
+	struct rds_stats_t stats;
+	struct rds_stats_state_t stats_state;
+	struct rds_ct_clock_t ct_clock;
+} rds_checkpoint_t;
+
+/*
+ * RDS encoder
+ *
+ * All the state of one encoder. Any number of them can run side by side,
+ * each one only used by its own encoder thread and the control side.
+ */
+typedef struct rds_encoder_t {
+	// written by the setters
+	struct rds_snapshot_t pending;
+	pthread_mutex_t update_mutex;
+	uint8_t update_depth;
+
+	// read by the encoder
+	struct rds_snapshot_t published;
+	uint32_t published_seq;
+
+	// the encoder's copy, and the one being read
+	struct rds_snapshot_t rds;
+	struct rds_snapshot_t next;
+	uint32_t rds_seq;
+
+	// encoder state
+	struct rds_encoder_state_t state;
+
+	/* Channel statistics
+	 *
+	 * Kept by the encoder and copied out for readers once per group.
+	 * A group is counted when it is built, a few groups before it goes
+	 * on air.
+	 */
+	struct rds_stats_t stats;
+	struct rds_stats_state_t stats_state;
+	struct rds_stats_t published_stats;
+	pthread_mutex_t stats_mutex;
+
+	struct rds_group_cache_t ps_cache;
+	struct rds_group_cache_t rt_cache;
+	struct rds_group_cache_t ptyn_cache;
+	struct rds_group_cache_t oda_cache;
+
+	// the cache entry the current group belongs to
+	struct {
+		struct rds_cached_group_t *group;
+		uint32_t gen;
+		uint8_t af; // 0A groups carry a rotating AF in block C
+	} cached;
+
+	// clock time
+	struct rds_ct_clock_t ct_clock;
+
+	// bits sent on air, counted by the modulator or the group output
+	uint64_t bits_sent;
+
+	/* Earliest time that still falls in a group that hasn't been built,
+	 * for other threads
+	 */
+	double build_time;
+
+	struct rds_group_hook_t group_hooks[MAX_GROUP_HOOKS];
+	uint8_t num_group_hooks;
+	// groups built since a group hook last changed something
+	uint32_t unchanged_groups;
+	// indexed by group
+	struct rds_checkpoint_t checkpoints[RDS_CHECKPOINTS];
+} rds_encoder_t;
+
+extern void init_rds_encoder(struct rds_encoder_t *enc);
+extern void set_rds_params(struct rds_encoder_t *enc,
+	struct rds_params_t rds_params, char *call_sign);
+extern void show_rds_params(struct rds_encoder_t *enc);
+extern void get_rds_bits(struct rds_encoder_t *enc, uint64_t *bits);
+extern void begin_rds_update(struct rds_encoder_t *enc);
+extern void end_rds_update(struct rds_encoder_t *enc);
+extern void set_rds_pi(struct rds_encoder_t *enc, uint16_t pi_code);
+extern void set_rds_rt(struct rds_encoder_t *enc, char *rt);
+extern void set_rds_ps(struct rds_encoder_t *enc, char *ps);
+extern void set_rds_rtplus_flags(struct rds_encoder_t *enc, uint8_t running,
+	uint8_t toggle);
+extern void set_rds_rtplus_tags(struct rds_encoder_t *enc, uint8_t *tags);
+extern void set_rds_ta(struct rds_encoder_t *enc, uint8_t ta);
+extern void set_rds_pty(struct rds_encoder_t *enc, uint8_t pty);
+extern void set_rds_ptyn(struct rds_encoder_t *enc, char *ptyn);
+extern void set_rds_af(struct rds_encoder_t *enc, struct rds_af_t new_af_list);
+extern void clear_rds_af(struct rds_encoder_t *enc);
 extern int8_t add_rds_af(struct rds_af_t *af_list, float freq);
-extern void set_rds_tp(uint8_t tp);
-extern void set_rds_ms(uint8_t ms);
-extern void set_rds_ab(uint8_t ab);
-extern void set_rds_ct(uint8_t ct);
-extern void set_rds_di(uint8_t di);
-extern float get_rds_sample(uint8_t stream_num);
+extern void set_rds_tp(struct rds_encoder_t *enc, uint8_t tp);
+extern void set_rds_ms(struct rds_encoder_t *enc, uint8_t ms);
+extern void set_rds_ab(struct rds_encoder_t *enc, uint8_t ab);
+extern void set_rds_ct(struct rds_encoder_t *enc, uint8_t ct);
+extern void set_rds_ct_latency(struct rds_encoder_t *enc, float latency);
+extern uint64_t get_rds_group_at(struct rds_encoder_t *enc, double time);
+extern int8_t add_rds_group_hook(struct rds_encoder_t *enc,
+	uint8_t (*hook)(void *arg, uint64_t group), void *arg);
+extern void get_rds_stats(struct rds_encoder_t *enc, struct rds_stats_t *out);
+extern void set_rds_di(struct rds_encoder_t *enc, uint8_t di);
+extern int8_t set_rds_group_rates(struct rds_encoder_t *enc, char *rates);
+extern int8_t set_rds_oda(struct rds_encoder_t *enc, uint8_t group,
+	uint16_t aid, uint16_t scb);
+extern void add_rds_group_sent(struct rds_encoder_t *enc);
+extern double get_rds_build_time(struct rds_encoder_t *enc);
+extern void rewind_rds_encoder(struct rds_encoder_t *enc, uint16_t count);
 
 #endif /* RDS_H */
@@ -17,61 +17,437 @@
  */
 
 #include "common.h"
+#include <pthread.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
 #include "rds.h"
 #include "rds_lib.h"
-#include "waveforms.h"
+#include "event_loop.h"
+#include "rds2.h"
 
 /*
  * RDS2-specific stuff
  */
 
+/*
+ * File transfer
+ *
+ * Files are cut into chunks. Each chunk goes out as a header group
+ * (file ID, chunk number, number of chunks, chunk length and the
+ * CRC-CCITT of the chunk) followed by its data, 7 bytes per group.
+ * The groups of a file are encoded once when it is queued or replaced.
+ *
+ * A carousel sends its files in turn, each file a given number of times
+ * or until it is removed. Every stream has its own carousel, and there
+ * is one shared by all streams. A stream that is done with its chunk
+ * takes the next one from its own carousel, or from the shared one when
+ * its own is empty. Files in the shared carousel are thus striped over
+ * the streams while a stream can also carry a service of its own.
+ *
+ * A stream's state is only touched by the thread generating its groups,
+ * so the streams can be generated in parallel. The carousels have their
+ * own locks.
+ */
+static struct rds2_carousel_t shared_carousel = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static struct rds2_stream_t streams[RDS2_STREAMS] = {
+	{.carousel = {.mutex = PTHREAD_MUTEX_INITIALIZER}},
+	{.carousel = {.mutex = PTHREAD_MUTEX_INITIALIZER}},
+	{.carousel = {.mutex = PTHREAD_MUTEX_INITIALIZER}}
+};
+
+static uint8_t last_id;
+
 // station logo
-extern unsigned char station_logo[];
-extern unsigned int station_logo_len;
+static struct {
+	char path[PATH_MAX];
+	uint8_t stream;
+	int16_t id;
+	int inotify_fd;
+	int watch;
+} logo = {.id = -1, .inotify_fd = -1, .watch = -1};
+
+static pthread_mutex_t logo_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 /*
  * Stuff for group type C
  */
 
+static void put_group_bytes(uint8_t fh, uint8_t *bytes, uint64_t *bits) {
+	uint16_t blocks[GROUP_LENGTH];
+
+	blocks[0] = fh << 8 | bytes[0];
+	blocks[1] = bytes[1] << 8 | bytes[2];
+	blocks[2] = bytes[3] << 8 | bytes[4];
+	blocks[3] = bytes[5] << 8 | bytes[6];
+	add_checkwords(blocks, bits);
+}
+
+/* Encode every chunk of a file
+ * Chunk n starts at group n * (RDS2_CHUNK_GROUPS + 1)
+ */
+static int8_t encode_file(struct rds2_file_t *file, uint8_t *data, uint32_t len) {
+	uint8_t bytes[RDS2_BYTES_PER_GROUP];
+	uint8_t chunk[RDS2_CHUNK_SIZE];
+	uint64_t (*groups)[GROUP_WORDS];
+	uint16_t num_chunks = (len + RDS2_CHUNK_SIZE - 1) / RDS2_CHUNK_SIZE;
+	uint16_t crc;
+	uint8_t chunk_len;
+
+	if (len == 0 || num_chunks > RDS2_MAX_CHUNKS) {
+		fprintf(stderr, "RDS2 file must be 1-%u bytes.\n",
+			RDS2_MAX_CHUNKS * RDS2_CHUNK_SIZE);
+		return -1;
+	}
+
+	groups = malloc(num_chunks * (RDS2_CHUNK_GROUPS + 1) * sizeof(*groups));
+	if (groups == NULL) return -1;
+
+	for (uint16_t i = 0; i < num_chunks; i++) {
+		chunk_len = len - i * RDS2_CHUNK_SIZE < RDS2_CHUNK_SIZE ?
+			len - i * RDS2_CHUNK_SIZE : RDS2_CHUNK_SIZE;
+		memset(chunk, 0, RDS2_CHUNK_SIZE);
+		memcpy(chunk, data + i * RDS2_CHUNK_SIZE, chunk_len);
+		crc = crc16_ccitt(chunk, chunk_len);
+
+		bytes[0] = file->id;
+		bytes[1] = i >> 4;
+		bytes[2] = (i & 15) << 4 | num_chunks >> 8;
+		bytes[3] = num_chunks & 255;
+		bytes[4] = chunk_len;
+		bytes[5] = crc >> 8;
+		bytes[6] = crc & 255;
+		put_group_bytes(RDS2_FH_HEADER, bytes,
+			groups[i * (RDS2_CHUNK_GROUPS + 1)]);
+
+		for (uint8_t j = 0; j < RDS2_CHUNK_GROUPS; j++) {
+			put_group_bytes(RDS2_FH_DATA, &chunk[j * RDS2_BYTES_PER_GROUP],
+				groups[i * (RDS2_CHUNK_GROUPS + 1) + 1 + j]);
+		}
+	}
+
+	file->groups = groups;
+	file->len = len;
+	file->num_chunks = num_chunks;
+
+	return 0;
+}
+
+static void show_file(struct rds2_file_t *file, uint8_t stream) {
+	// a header group per chunk, shared by the streams
+	uint32_t groups = file->num_chunks +
+		(file->len + RDS2_BYTES_PER_GROUP - 1) / RDS2_BYTES_PER_GROUP;
+
+	fprintf(stderr, "RDS2 file %u: %u bytes in %u chunks, "
+		"about %.1f s per pass.\n", file->id, file->len, file->num_chunks,
+		groups / ((stream ? 1 : RDS2_STREAMS) * RDS_GROUP_RATE));
+}
+
+/* Carousel of a stream, 0 for the shared one */
+static struct rds2_carousel_t *get_carousel(uint8_t stream) {
+	return stream ? &streams[stream - 1].carousel : &shared_carousel;
+}
+
+static void remove_file(struct rds2_carousel_t *carousel, uint8_t i) {
+	free(carousel->files[i].groups);
+	memmove(&carousel->files[i], &carousel->files[i + 1],
+		(carousel->num_files - i - 1) * sizeof(struct rds2_file_t));
+	carousel->num_files--;
+	if (carousel->current > i) carousel->current--;
+	if (carousel->current >= carousel->num_files) carousel->current = 0;
+}
+
+/* Add a file to the carousel of a stream (1-3) or to the shared one (0).
+ * The data is encoded right away and need not be kept.
+ * Returns the file ID or -1 on error
+ */
+int16_t queue_rds2_file(uint8_t stream, uint8_t *data, uint32_t len,
+	uint8_t repeat) {
+	struct rds2_carousel_t *carousel;
+	struct rds2_file_t file;
+
+	if (stream > RDS2_STREAMS) {
+		fprintf(stderr, "RDS2 stream must be 0-%u.\n", RDS2_STREAMS);
+		return -1;
+	}
+	carousel = get_carousel(stream);
+
+	// IDs start at 1
+	do {
+		file.id = __atomic_add_fetch(&last_id, 1, __ATOMIC_RELAXED);
+	} while (file.id == 0);
+
+	file.repeat = repeat;
+	if (encode_file(&file, data, len) < 0) return -1;
+
+	pthread_mutex_lock(&carousel->mutex);
+	if (carousel->num_files == RDS2_MAX_FILES) {
+		pthread_mutex_unlock(&carousel->mutex);
+		fprintf(stderr, "RDS2 file queue is full.\n");
+		free(file.groups);
+		return -1;
+	}
+	carousel->files[carousel->num_files++] = file;
+	pthread_mutex_unlock(&carousel->mutex);
+
+	show_file(&file, stream);
+
+	return file.id;
+}
+
+/* Swap the content of a queued file. Chunks already being sent are
+ * finished and the new content starts from its first chunk.
+ */
+int8_t replace_rds2_file(uint8_t id, uint8_t *data, uint32_t len) {
+	struct rds2_carousel_t *carousel;
+	struct rds2_file_t file;
+	uint64_t (*old_groups)[GROUP_WORDS] = NULL;
+	uint8_t i, s;
+
+	file.id = id;
+	if (encode_file(&file, data, len) < 0) return -1;
+
+	for (s = 0; s <= RDS2_STREAMS && old_groups == NULL; s++) {
+		carousel = get_carousel(s);
+		pthread_mutex_lock(&carousel->mutex);
+		for (i = 0; i < carousel->num_files; i++) {
+			if (carousel->files[i].id == id) break;
+		}
+		if (i < carousel->num_files) {
+			old_groups = carousel->files[i].groups;
+			carousel->files[i].groups = file.groups;
+			carousel->files[i].len = file.len;
+			carousel->files[i].num_chunks = file.num_chunks;
+			if (carousel->current == i) carousel->next_chunk = 0;
+		}
+		pthread_mutex_unlock(&carousel->mutex);
+	}
+
+	if (old_groups == NULL) {
+		free(file.groups);
+		return -1;
+	}
+	free(old_groups);
+	show_file(&file, s - 1);
+
+	return 0;
+}
+
+void remove_rds2_file(uint8_t id) {
+	struct rds2_carousel_t *carousel;
+
+	for (uint8_t s = 0; s <= RDS2_STREAMS; s++) {
+		carousel = get_carousel(s);
+		pthread_mutex_lock(&carousel->mutex);
+		for (uint8_t i = 0; i < carousel->num_files; i++) {
+			if (carousel->files[i].id == id) {
+				remove_file(carousel, i);
+				break;
+			}
+		}
+		pthread_mutex_unlock(&carousel->mutex);
+	}
+}
+
+/* Hand the next chunk of a carousel to a stream
+ * Returns 0 if there is nothing to send
+ */
+static uint8_t get_next_chunk(struct rds2_carousel_t *carousel,
+	struct rds2_stream_t *stream) {
+	struct rds2_file_t *file;
+	uint32_t offset;
+	uint8_t chunk_len;
+
+	pthread_mutex_lock(&carousel->mutex);
+	if (carousel->num_files == 0) {
+		pthread_mutex_unlock(&carousel->mutex);
+		return 0;
+	}
+
+	file = &carousel->files[carousel->current];
+	offset = carousel->next_chunk * RDS2_CHUNK_SIZE;
+	chunk_len = file->len - offset < RDS2_CHUNK_SIZE ?
+		file->len - offset : RDS2_CHUNK_SIZE;
+
+	stream->num_groups = 1 +
+		(chunk_len + RDS2_BYTES_PER_GROUP - 1) / RDS2_BYTES_PER_GROUP;
+	memcpy(stream->groups,
+		file->groups[carousel->next_chunk * (RDS2_CHUNK_GROUPS + 1)],
+		stream->num_groups * sizeof(stream->groups[0]));
+	stream->group = 0;
+
+	// move on to the next file after the last chunk
+	if (++carousel->next_chunk == file->num_chunks) {
+		carousel->next_chunk = 0;
+		if (file->repeat && --file->repeat == 0) {
+			remove_file(carousel, carousel->current);
+		} else if (++carousel->current == carousel->num_files) {
+			carousel->current = 0;
+		}
+	}
+	pthread_mutex_unlock(&carousel->mutex);
+
+	return 1;
+}
+
 /*
- * Station logo group (not fully implemented)
- * See https://www.youtube.com/watch?v=ticcJpCPoa8
+ * Station logo
+ *
+ * Loaded from a file at run time and sent forever. The file is watched
+ * so a new logo goes on air as soon as it has been written.
  */
-static void get_logo_group(uint16_t *blocks) {
-	/*
-	 * Function Header
-	 *
-	 * (from http://www.rds.org.uk/2010/pdf/RDS%202%20-%20what%20it%20is_170127_13.pdf)
-	 * Could this be for indicating the tunneled group?
+static void poll_rds2_logo(void *arg);
+
+static int8_t load_logo(char *path) {
+	struct stat st;
+	uint8_t *data;
+	int fd;
+	int8_t r;
+
+	if ((fd = open(path, O_RDONLY)) < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "Could not open station logo %s.\n", path);
+		if (fd >= 0) close(fd);
+		return -1;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "Could not map station logo %s.\n", path);
+		return -1;
+	}
+
+	if (logo.id < 0) {
+		logo.id = queue_rds2_file(logo.stream, data, st.st_size, 0);
+		r = logo.id < 0 ? -1 : 0;
+	} else {
+		r = replace_rds2_file(logo.id, data, st.st_size);
+	}
+
+	munmap(data, st.st_size);
+	return r;
+}
+
+/* Send a logo on a stream (1-3) or striped over all of them (0) */
+int8_t set_rds2_logo(uint8_t stream, char *path) {
+	char dir[PATH_MAX];
+	int8_t r;
+
+	if (stream > RDS2_STREAMS) {
+		fprintf(stderr, "RDS2 stream must be 0-%u.\n", RDS2_STREAMS);
+		return -1;
+	}
+
+	pthread_mutex_lock(&logo_mutex);
+
+	// a logo moving to another stream is queued there afresh
+	if (logo.id >= 0 && stream != logo.stream) {
+		remove_rds2_file(logo.id);
+		logo.id = -1;
+	}
+	logo.stream = stream;
+
+	r = load_logo(path);
+	if (r < 0) {
+		pthread_mutex_unlock(&logo_mutex);
+		return r;
+	}
+	strncpy(logo.path, path, PATH_MAX - 1);
+
+	/* Watch the directory rather than the file itself, since a logo
+	 * is often replaced by renaming a new file over it
 	 */
-	static uint8_t fh = 8 << 4 | 1 << 3 /* group 8B? */ | 0;
-	static uint16_t logo_pos;
-
-	blocks[0] |= fh << 8 | station_logo[logo_pos];
-	blocks[1] = station_logo[logo_pos+1] << 8 | station_logo[logo_pos+2];
-	blocks[2] = station_logo[logo_pos+3] << 8 | station_logo[logo_pos+4];
-	blocks[3] = station_logo[logo_pos+5] << 8 | station_logo[logo_pos+6];
-	if ((logo_pos += 7) >= station_logo_len) logo_pos = 0;
+	if (logo.inotify_fd < 0) {
+		logo.inotify_fd = inotify_init1(IN_NONBLOCK);
+		if (logo.inotify_fd >= 0 &&
+			add_event_fd(logo.inotify_fd, poll_rds2_logo, NULL) < 0) {
+			close(logo.inotify_fd);
+			logo.inotify_fd = -1;
+		}
+	}
+	if (logo.inotify_fd >= 0) {
+		if (logo.watch >= 0) inotify_rm_watch(logo.inotify_fd, logo.watch);
+		strncpy(dir, path, PATH_MAX - 1);
+		dir[PATH_MAX - 1] = 0;
+		logo.watch = inotify_add_watch(logo.inotify_fd, dirname(dir),
+			IN_CLOSE_WRITE | IN_MOVED_TO);
+	}
+
+	pthread_mutex_unlock(&logo_mutex);
+	return 0;
+}
+
+/* Set the logo from "[STREAM,]FILE" as given on the command line or
+ * the control pipe. Without a stream the logo is striped over all of them.
+ */
+int8_t parse_rds2_logo(char *arg) {
+	uint8_t stream = 0;
+	char *comma = strchr(arg, ',');
+
+	if (comma && comma - arg == 1 && arg[0] >= '0' && arg[0] <= '9') {
+		stream = arg[0] - '0';
+		arg = comma + 1;
+	}
+
+	return set_rds2_logo(stream, arg);
+}
+
+/* Reload the logo if its file has changed. Does not block. */
+static void poll_rds2_logo(void *arg) {
+	char buf[sizeof(struct inotify_event) + NAME_MAX + 1]
+		__attribute__((aligned(__alignof__(struct inotify_event))));
+	struct inotify_event *event;
+	char name[PATH_MAX];
+	uint8_t changed = 0;
+	ssize_t len;
+	(void)arg;
+
+	pthread_mutex_lock(&logo_mutex);
+	if (logo.inotify_fd < 0) {
+		pthread_mutex_unlock(&logo_mutex);
+		return;
+	}
+
+	strncpy(name, logo.path, PATH_MAX - 1);
+	name[PATH_MAX - 1] = 0;
+	while ((len = read(logo.inotify_fd, buf, sizeof(buf))) > 0) {
+		for (char *p = buf; p < buf + len;
+			p += sizeof(struct inotify_event) + event->len) {
+			event = (struct inotify_event *)p;
+			if (event->len && strcmp(event->name, basename(name)) == 0)
+				changed = 1;
+		}
+	}
+
+	if (changed) {
+		fprintf(stderr, "Station logo %s changed.\n", logo.path);
+		load_logo(logo.path);
+	}
+	pthread_mutex_unlock(&logo_mutex);
 }
 
 /*
- * RDS 2 group sequence
+ * File transfer group
  */
-static void get_rds2_group(int stream_num, uint16_t *blocks) {
-	switch (stream_num) {
-	case 0:
-	case 1:
-	case 2:
-		get_logo_group(blocks);
-		break;
+static void get_file_group(struct rds2_stream_t *stream, uint64_t *bits) {
+	uint8_t idle[RDS2_BYTES_PER_GROUP] = {0};
+
+	if (stream->group == stream->num_groups &&
+		!get_next_chunk(&stream->carousel, stream) &&
+		!get_next_chunk(&shared_carousel, stream)) {
+		put_group_bytes(RDS2_FH_IDLE, idle, bits);
+		return;
 	}
 
-	//fprintf(stderr, "Stream %d: %04x %04x %04x %04x\n",
-	//	stream_num, blocks[0], blocks[1], blocks[2], blocks[3]);
+	memcpy(bits, stream->groups[stream->group++], sizeof(stream->groups[0]));
 }
 
-void get_rds2_bits(uint8_t stream, uint8_t *bits) {
-	static uint16_t out_blocks[GROUP_LENGTH];
-	get_rds2_group(stream, out_blocks);
-	add_checkwords(out_blocks, bits);
+void get_rds2_bits(uint8_t stream, uint64_t *bits) {
+	get_file_group(&streams[stream - 1], bits);
 }
@@ -16,4 +16,57 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-extern float get_rds2_bits(uint8_t stream_num, uint8_t *bits);
+#include <pthread.h>
+
+#define RDS2_STREAMS		3
+
+/* Function headers */
+#define RDS2_FH_DATA		(8 << 4 | 1 << 3 | 0)
+#define RDS2_FH_HEADER		(8 << 4 | 1 << 3 | 1)
+#define RDS2_FH_IDLE		(8 << 4 | 1 << 3 | 2)
+
+/* File transfer */
+#define RDS2_BYTES_PER_GROUP	7
+#define RDS2_CHUNK_GROUPS	16
+// at most 255 so the length fits in the chunk header
+#define RDS2_CHUNK_SIZE		(RDS2_CHUNK_GROUPS * RDS2_BYTES_PER_GROUP)
+// chunk numbers are 12 bits
+#define RDS2_MAX_CHUNKS		4095
+#define RDS2_MAX_FILES		8
+
+typedef struct rds2_file_t {
+	uint8_t id;
+	uint32_t len;
+	uint16_t num_chunks;
+	// passes left, 0 to send until removed
+	uint8_t repeat;
+	// encoded groups, RDS2_CHUNK_GROUPS + 1 per chunk
+	uint64_t (*groups)[GROUP_WORDS];
+} rds2_file_t;
+
+typedef struct rds2_carousel_t {
+	struct rds2_file_t files[RDS2_MAX_FILES];
+	uint8_t num_files;
+	// file and chunk handed out next
+	uint8_t current;
+	uint16_t next_chunk;
+	pthread_mutex_t mutex;
+} rds2_carousel_t;
+
+// encoder context of an RDS2 stream
+typedef struct rds2_stream_t {
+	// files only sent on this stream
+	struct rds2_carousel_t carousel;
+	// encoded groups of the chunk being sent
+	uint64_t groups[RDS2_CHUNK_GROUPS + 1][GROUP_WORDS];
+	uint8_t num_groups;
+	uint8_t group;
+} rds2_stream_t;
+
+extern int16_t queue_rds2_file(uint8_t stream, uint8_t *data, uint32_t len,
+	uint8_t repeat);
+extern int8_t replace_rds2_file(uint8_t id, uint8_t *data, uint32_t len);
+extern void remove_rds2_file(uint8_t id);
+extern int8_t set_rds2_logo(uint8_t stream, char *path);
+extern int8_t parse_rds2_logo(char *arg);
+extern void get_rds2_bits(uint8_t stream_num, uint64_t *bits);
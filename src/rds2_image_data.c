@@ -1,863 +0,0 @@
-unsigned char station_logo[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x0b, 0xdf, 0x81, 0xd0, 0x00, 0x00, 0x00,
-  0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x00, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x49, 0x6d, 0x61, 0x67,
-  0x65, 0x52, 0x65, 0x61, 0x64, 0x79, 0x71, 0xc9, 0x65, 0x3c, 0x00, 0x00,
-  0x01, 0x80, 0x50, 0x4c, 0x54, 0x45, 0xca, 0xcc, 0xcb, 0x25, 0x29, 0x26,
-  0xa2, 0xa4, 0xa3, 0x92, 0x94, 0x93, 0x82, 0x84, 0x83, 0xc2, 0xc4, 0xc3,
-  0x89, 0x8c, 0x8b, 0x9a, 0x9c, 0x9b, 0xaa, 0xac, 0xab, 0x7a, 0x7d, 0x7b,
-  0x72, 0x75, 0x73, 0xb2, 0xb4, 0xb3, 0xba, 0xbc, 0xbb, 0x6a, 0x6d, 0x6b,
-  0x5a, 0x5d, 0x5b, 0x62, 0x64, 0x63, 0xe5, 0xe6, 0xe4, 0x7f, 0x83, 0x81,
-  0x52, 0x55, 0x53, 0x4a, 0x4c, 0x4b, 0xd9, 0xdc, 0xda, 0x7c, 0x80, 0x7e,
-  0x1a, 0x1d, 0x1a, 0x42, 0x45, 0x43, 0x8c, 0x8f, 0x8e, 0xd8, 0xda, 0xd9,
-  0x3a, 0x3d, 0x3b, 0x84, 0x87, 0x85, 0xd6, 0xd9, 0xd8, 0x86, 0x89, 0x88,
-  0x8f, 0x92, 0x90, 0x76, 0x7a, 0x79, 0x74, 0x78, 0x76, 0xd5, 0xd8, 0xd6,
-  0xd1, 0xd2, 0xd1, 0x32, 0x35, 0x33, 0x95, 0x97, 0x96, 0x1c, 0x20, 0x1c,
-  0x6e, 0x72, 0x71, 0xdb, 0xdd, 0xdc, 0x6b, 0x6f, 0x6d, 0x14, 0x19, 0x15,
-  0xc5, 0xc7, 0xc6, 0x5d, 0x60, 0x5d, 0xdc, 0xde, 0xdd, 0x3c, 0x41, 0x3d,
-  0xcd, 0xcf, 0xce, 0xd2, 0xd4, 0xd2, 0x9d, 0x9f, 0x9e, 0x64, 0x67, 0x65,
-  0x5f, 0x62, 0x61, 0xa5, 0xa7, 0xa6, 0x2b, 0x30, 0x2c, 0xd4, 0xd6, 0xd5,
-  0x4c, 0x4f, 0x4d, 0x66, 0x6a, 0x68, 0xad, 0xaf, 0xae, 0x12, 0x16, 0x13,
-  0x35, 0x38, 0x35, 0x55, 0x58, 0x55, 0xbd, 0xbf, 0xbd, 0x45, 0x49, 0x45,
-  0x9f, 0xa2, 0xa0, 0xa7, 0xaa, 0xa8, 0x97, 0x9a, 0x99, 0x3e, 0x43, 0x40,
-  0xd2, 0xd5, 0xd4, 0x4e, 0x52, 0x50, 0xc7, 0xca, 0xc9, 0x1e, 0x24, 0x21,
-  0xd0, 0xd1, 0xce, 0xb5, 0xb7, 0xb6, 0x57, 0x5a, 0x58, 0xd4, 0xd5, 0xd2,
-  0x45, 0x4b, 0x48, 0xb7, 0xba, 0xb8, 0xaf, 0xb2, 0xb0, 0xce, 0xd1, 0xd0,
-  0xbf, 0xc1, 0xc0, 0x35, 0x3b, 0x39, 0x2e, 0x33, 0x30, 0x16, 0x1b, 0x18,
-  0xe1, 0xe2, 0xde, 0x0e, 0x16, 0x11, 0x7f, 0x81, 0x7f, 0x08, 0x08, 0x08,
-  0xd8, 0xd9, 0xd6, 0x40, 0x42, 0x3f, 0x88, 0x8a, 0x86, 0xc8, 0xc9, 0xc7,
-  0xdf, 0xe0, 0xdc, 0xa0, 0xa2, 0x9e, 0x48, 0x4a, 0x47, 0x98, 0x9a, 0x97,
-  0x0d, 0x11, 0x0e, 0xb0, 0xb1, 0xaf, 0x60, 0x62, 0x5e, 0x90, 0x91, 0x8f,
-  0x78, 0x7a, 0x77, 0x50, 0x52, 0x4f, 0x18, 0x1a, 0x17, 0x59, 0x5a, 0x57,
-  0xb9, 0xba, 0xb8, 0xc0, 0xc1, 0xbf, 0x20, 0x22, 0x20, 0x68, 0x6b, 0x67,
-  0x70, 0x71, 0x6e, 0x30, 0x32, 0x2f, 0xde, 0xde, 0xda, 0xa9, 0xab, 0xa7,
-  0x39, 0x3b, 0x38, 0xdf, 0xe0, 0xe0, 0x1d, 0x1e, 0x1f, 0x10, 0x15, 0x0f,
-  0xdb, 0xdb, 0xd8, 0x34, 0x36, 0x36, 0x44, 0x47, 0x46, 0x15, 0x17, 0x16,
-  0x66, 0x68, 0x67, 0x2b, 0x2d, 0x2c, 0x86, 0x86, 0x84, 0xaf, 0xaf, 0xaf,
-  0xa6, 0xa7, 0xa4, 0x5c, 0x5e, 0x5d, 0x3c, 0x3f, 0x3e, 0x6d, 0x6f, 0x6e,
-  0x68, 0x68, 0x67, 0x00, 0x00, 0x00, 0xbc, 0x1d, 0x0f, 0xa6, 0x00, 0x00,
-  0x26, 0x60, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xec, 0x9c, 0xfb, 0x43,
-  0xda, 0xe8, 0xb6, 0xf7, 0x09, 0x84, 0x4b, 0x82, 0x40, 0x49, 0x0a, 0x41,
-  0x28, 0x10, 0xe5, 0x32, 0x08, 0xa3, 0x12, 0xc0, 0x80, 0x09, 0xa8, 0x14,
-  0x29, 0xd4, 0x2b, 0xb4, 0x38, 0xe0, 0x88, 0x17, 0x2e, 0xb6, 0x20, 0xbb,
-  0x14, 0x47, 0x90, 0xb6, 0xc2, 0xf8, 0xaf, 0xbf, 0x6b, 0x05, 0x67, 0xef,
-  0xd9, 0xfb, 0xdd, 0xe7, 0xbc, 0xd5, 0xb1, 0xe7, 0xdd, 0x3f, 0x9c, 0xa7,
-  0x15, 0x6f, 0x63, 0xfd, 0xcc, 0x5a, 0xeb, 0xf9, 0xae, 0xef, 0x7a, 0x12,
-  0x50, 0xdd, 0xff, 0x47, 0x2e, 0xd5, 0xff, 0x62, 0xfd, 0x2f, 0xd6, 0x3f,
-  0xaf, 0x41, 0xe4, 0xea, 0xaa, 0xfe, 0x9f, 0x83, 0x75, 0x54, 0x95, 0x27,
-  0xbd, 0x8e, 0xcf, 0x72, 0x65, 0x89, 0xdc, 0x45, 0xfe, 0x63, 0xb0, 0xda,
-  0x74, 0x85, 0x0a, 0x89, 0x99, 0x4b, 0xb9, 0xce, 0xd4, 0xaf, 0x7a, 0x43,
-  0xf1, 0xe8, 0xff, 0x03, 0x56, 0x7b, 0xcc, 0xca, 0x75, 0x62, 0x74, 0x74,
-  0x74, 0x76, 0x76, 0x7d, 0x7d, 0x86, 0x5f, 0x19, 0x5f, 0x5c, 0x98, 0xee,
-  0x72, 0x25, 0xa9, 0x97, 0x91, 0xc5, 0xba, 0xee, 0x93, 0xa1, 0xd0, 0xf9,
-  0x9f, 0xc6, 0x3a, 0xaa, 0x16, 0xc5, 0x43, 0x5f, 0x46, 0x96, 0xf9, 0x2f,
-  0x14, 0x26, 0xac, 0x7b, 0x75, 0x39, 0x8e, 0x08, 0x72, 0xab, 0xdf, 0x2f,
-  0x39, 0x97, 0x97, 0xab, 0x55, 0xf9, 0xd2, 0xf1, 0xe6, 0xf8, 0xf8, 0xd4,
-  0x09, 0xf1, 0xb2, 0xdf, 0xb4, 0x64, 0x56, 0x1a, 0xfc, 0x4f, 0x60, 0x11,
-  0x6c, 0xc9, 0x77, 0x98, 0xcd, 0xc8, 0x94, 0xb9, 0x75, 0xa5, 0xae, 0x88,
-  0x7d, 0xa7, 0xd4, 0x12, 0x4c, 0x4c, 0xd6, 0x9c, 0x3d, 0x3c, 0x2c, 0x2d,
-  0x47, 0xba, 0x97, 0x72, 0xb3, 0x56, 0x33, 0x6a, 0x8f, 0xd3, 0x05, 0xc7,
-  0x94, 0xa6, 0x9a, 0x4d, 0x26, 0xc2, 0xdf, 0xde, 0xb2, 0xeb, 0x3f, 0x18,
-  0xab, 0xc3, 0x8c, 0x89, 0x22, 0x45, 0x9b, 0x4c, 0x3b, 0x2e, 0x3f, 0xdd,
-  0x2c, 0x68, 0x4f, 0x04, 0x31, 0xdb, 0x92, 0x99, 0x56, 0x76, 0x59, 0x72,
-  0xee, 0x64, 0x99, 0x66, 0xc4, 0x44, 0x3a, 0xe6, 0x3e, 0x7c, 0x38, 0xfe,
-  0xe4, 0x21, 0x2f, 0x2e, 0x99, 0x61, 0x9f, 0x15, 0x5b, 0x55, 0x1f, 0x67,
-  0xf2, 0xb4, 0x8e, 0x7e, 0x24, 0x56, 0x47, 0xee, 0x10, 0x97, 0x47, 0x1d,
-  0xeb, 0xc5, 0x55, 0x32, 0x64, 0x48, 0x7d, 0x4a, 0xa5, 0x0b, 0x27, 0x72,
-  0x96, 0x8d, 0x84, 0x64, 0xc6, 0x2c, 0xee, 0xb0, 0x19, 0x4a, 0x5d, 0x6c,
-  0x92, 0x95, 0xf3, 0x8f, 0xc6, 0x4f, 0x0d, 0xfa, 0xb2, 0xee, 0x14, 0xeb,
-  0xd5, 0x49, 0x56, 0xcc, 0x48, 0x5c, 0x4e, 0xe3, 0x61, 0x7e, 0x20, 0xd6,
-  0x91, 0xd8, 0xee, 0x58, 0x8e, 0xee, 0x13, 0x5d, 0x51, 0x7d, 0x62, 0x53,
-  0xcf, 0xa5, 0x77, 0xf5, 0x7a, 0x8d, 0x69, 0x79, 0x68, 0xfd, 0xc6, 0xd7,
-  0x6c, 0xc1, 0xa6, 0x20, 0x9c, 0x68, 0x1d, 0xb5, 0xca, 0x95, 0x31, 0x55,
-  0xb9, 0x35, 0x67, 0xaa, 0xbe, 0xe5, 0x6a, 0x86, 0x73, 0x8e, 0x7d, 0xcb,
-  0x89, 0x9d, 0x4c, 0x52, 0xe3, 0x1e, 0xfc, 0x38, 0xac, 0xc9, 0xd8, 0x2e,
-  0xda, 0xef, 0xcf, 0xae, 0xa4, 0x71, 0xed, 0x38, 0xaa, 0xf9, 0xf6, 0xe9,
-  0xdb, 0x97, 0x26, 0x45, 0x5d, 0x4c, 0xf5, 0xe1, 0x6f, 0x29, 0x9b, 0x47,
-  0xad, 0x0b, 0x45, 0x3f, 0x6a, 0x4f, 0x1c, 0xdd, 0xc6, 0xa9, 0xb5, 0x7e,
-  0x58, 0x92, 0x96, 0x2f, 0xaa, 0x1c, 0xc3, 0x66, 0x13, 0xf9, 0xc4, 0xce,
-  0xb2, 0x18, 0x8a, 0x25, 0xa5, 0xd1, 0x8f, 0xc2, 0x32, 0x13, 0x22, 0x7d,
-  0x7f, 0x74, 0xe9, 0x23, 0x3a, 0xf2, 0x89, 0xbf, 0xa2, 0xe3, 0xa9, 0x8b,
-  0x56, 0xf7, 0xaa, 0x76, 0x9a, 0x4a, 0xeb, 0x3f, 0xd5, 0x4e, 0x0f, 0xc2,
-  0x2e, 0xd3, 0xb7, 0x4f, 0xfa, 0xd3, 0x2b, 0x9e, 0xac, 0xd4, 0x89, 0x44,
-  0xa2, 0x2e, 0x54, 0x13, 0x75, 0xb1, 0x44, 0xe4, 0x7d, 0xce, 0xec, 0x0e,
-  0xcb, 0xb6, 0xcc, 0x4c, 0xf5, 0xc7, 0x60, 0x1d, 0x65, 0xf2, 0x3c, 0x73,
-  0x54, 0x4f, 0x04, 0xec, 0xf6, 0xac, 0x29, 0x49, 0x5f, 0xc9, 0x17, 0x75,
-  0xf9, 0x62, 0xb9, 0x09, 0xb9, 0x6c, 0x52, 0x02, 0xad, 0x7a, 0xf3, 0x89,
-  0xd7, 0x51, 0xcd, 0x8a, 0x60, 0xe2, 0x75, 0xf5, 0x92, 0xb3, 0xd4, 0x6f,
-  0x49, 0x9d, 0x96, 0x3c, 0x4e, 0x24, 0x4a, 0x92, 0x98, 0x73, 0xc6, 0x48,
-  0xbd, 0x4b, 0x64, 0x46, 0x3f, 0x02, 0x6b, 0xd0, 0x0a, 0xc8, 0x23, 0x31,
-  0x9f, 0xb7, 0x97, 0xcb, 0x4b, 0xce, 0xa2, 0x70, 0xeb, 0x6c, 0x55, 0xc5,
-  0x7a, 0x49, 0xfc, 0xf6, 0xcd, 0xc4, 0x88, 0x62, 0xd6, 0x90, 0xd6, 0xc9,
-  0x21, 0x41, 0xb4, 0x74, 0xe9, 0x16, 0xd5, 0xca, 0x26, 0xfa, 0x89, 0x7a,
-  0x46, 0xba, 0x14, 0xaa, 0x3e, 0x71, 0xc7, 0xb9, 0xc3, 0x8e, 0x8b, 0xde,
-  0xf8, 0x9c, 0x86, 0x35, 0x1f, 0xfd, 0x88, 0x68, 0x5d, 0x81, 0x8a, 0xe6,
-  0x15, 0xac, 0xb2, 0x2f, 0xc3, 0x99, 0xa4, 0x61, 0x95, 0xcb, 0x4a, 0xd9,
-  0x50, 0xb3, 0x5e, 0xed, 0x2f, 0x4b, 0x4d, 0xbf, 0xd0, 0x92, 0xe5, 0x2a,
-  0x67, 0x6a, 0xb6, 0x42, 0x5d, 0x99, 0x48, 0xf4, 0xfa, 0x6c, 0xb5, 0x5e,
-  0xcf, 0x44, 0x42, 0x1c, 0x93, 0x13, 0xb3, 0x2c, 0x43, 0x79, 0xd2, 0xbb,
-  0x96, 0xd6, 0x0f, 0xc0, 0x22, 0xfc, 0xc1, 0x71, 0x39, 0x10, 0x28, 0x07,
-  0x88, 0x84, 0xc4, 0x66, 0x25, 0x69, 0xdc, 0x83, 0x1a, 0xca, 0x3a, 0x97,
-  0x33, 0x12, 0x41, 0xf4, 0x88, 0xe5, 0x0b, 0x4b, 0x84, 0xb9, 0xe8, 0x73,
-  0x64, 0x2d, 0x32, 0xbd, 0x60, 0x13, 0xed, 0x44, 0x9f, 0xcb, 0x70, 0x13,
-  0xb6, 0x61, 0x1d, 0x9a, 0x19, 0x96, 0xcd, 0x71, 0xce, 0x9d, 0x58, 0x25,
-  0x79, 0x3b, 0x7a, 0x6e, 0xac, 0xd1, 0xd4, 0x7f, 0x62, 0x4e, 0x48, 0xbe,
-  0x3e, 0x41, 0x2c, 0x73, 0xdc, 0xa1, 0x2f, 0x41, 0x10, 0x84, 0xd4, 0x21,
-  0x9c, 0x09, 0x67, 0xbf, 0xd7, 0xe9, 0x10, 0x1d, 0x62, 0xc2, 0x5c, 0xca,
-  0x11, 0xa9, 0x6a, 0x16, 0xc4, 0x6a, 0x82, 0xe8, 0xb4, 0x3b, 0xbd, 0xcc,
-  0xc5, 0x65, 0xa6, 0x15, 0xad, 0xf5, 0xab, 0xcc, 0x90, 0xe5, 0x9c, 0xc4,
-  0xe1, 0xb8, 0x9f, 0x13, 0x6e, 0x07, 0xcf, 0x8b, 0x25, 0xd5, 0x44, 0xa2,
-  0x96, 0x19, 0xdb, 0xd4, 0x35, 0x93, 0x58, 0x94, 0x93, 0x09, 0x19, 0xb0,
-  0x3a, 0xb0, 0xf2, 0x04, 0x6c, 0xcc, 0x00, 0x2c, 0x42, 0x6a, 0x45, 0x32,
-  0xce, 0x40, 0xa2, 0xcf, 0xd6, 0x13, 0x84, 0xbd, 0x6d, 0xb7, 0x4b, 0xf5,
-  0x56, 0xab, 0x6a, 0xd1, 0x50, 0x37, 0x37, 0x39, 0x36, 0x3b, 0x19, 0xde,
-  0x94, 0x08, 0x42, 0x14, 0xd9, 0xdb, 0xb3, 0xe7, 0xc4, 0xba, 0x36, 0xb1,
-  0xf7, 0x53, 0xfa, 0x94, 0x26, 0xd3, 0x73, 0x7c, 0x91, 0x31, 0x77, 0xa5,
-  0x88, 0x64, 0xef, 0xd8, 0xed, 0x88, 0xa3, 0xd0, 0xc1, 0x87, 0x84, 0x18,
-  0xa9, 0x26, 0xe0, 0xd3, 0x16, 0x33, 0xee, 0xc0, 0x37, 0x3a, 0x01, 0xa7,
-  0x9c, 0x91, 0x68, 0x33, 0xeb, 0xf3, 0x65, 0x27, 0x45, 0x76, 0xe7, 0xc6,
-  0x39, 0x26, 0x7a, 0x37, 0x93, 0xfa, 0xdd, 0xe4, 0xe8, 0xf9, 0xb0, 0x5a,
-  0xb5, 0xde, 0xfd, 0xef, 0xe2, 0x95, 0xa1, 0x16, 0xd9, 0xa2, 0x7d, 0x25,
-  0x89, 0x4b, 0xe4, 0x9d, 0x76, 0xbb, 0xbd, 0x0d, 0x41, 0x69, 0x2b, 0x78,
-  0xf0, 0x81, 0xdd, 0xc7, 0x40, 0xc7, 0x0c, 0xf4, 0xe8, 0x96, 0x73, 0x46,
-  0xea, 0xe3, 0x96, 0x13, 0x4e, 0x67, 0xdd, 0xd7, 0x3b, 0x24, 0xb2, 0x13,
-  0x82, 0xc8, 0x12, 0xc4, 0xb8, 0x37, 0xbe, 0x11, 0xd9, 0x56, 0xfb, 0xd9,
-  0xb0, 0x62, 0x5f, 0x9a, 0x17, 0x75, 0xc2, 0x49, 0x9d, 0x86, 0x04, 0xef,
-  0x32, 0x14, 0x55, 0x29, 0x9f, 0xe8, 0x00, 0x94, 0xf2, 0x57, 0x59, 0xa3,
-  0x76, 0x3b, 0x31, 0x71, 0x12, 0x6d, 0xfb, 0x30, 0xc2, 0x56, 0x89, 0x00,
-  0x91, 0xb7, 0xb7, 0x3b, 0x9d, 0xb1, 0x8f, 0x18, 0x5b, 0xaa, 0x89, 0x12,
-  0x31, 0x96, 0xf2, 0xe3, 0x21, 0xd4, 0x1f, 0x31, 0x18, 0x13, 0x93, 0x5c,
-  0xb1, 0xf3, 0x4c, 0x58, 0x47, 0xb4, 0xd0, 0x32, 0x99, 0x13, 0xbe, 0x1c,
-  0x6d, 0xca, 0x89, 0x4c, 0x3e, 0x3f, 0x86, 0x42, 0x09, 0xd8, 0x15, 0xa6,
-  0xd1, 0x68, 0x86, 0x35, 0x1a, 0x11, 0xe3, 0x7c, 0xa7, 0x6d, 0xf7, 0x25,
-  0x7c, 0xbd, 0x4e, 0x4f, 0x02, 0xa6, 0x4e, 0xbe, 0xe7, 0x24, 0xc6, 0xb9,
-  0xf1, 0x00, 0xbe, 0x1e, 0xb0, 0x13, 0x13, 0x28, 0xc2, 0xf1, 0xa0, 0x33,
-  0xc8, 0x1f, 0x96, 0x86, 0xbe, 0x67, 0xc1, 0x1a, 0xdd, 0x31, 0xad, 0xc6,
-  0xae, 0xb0, 0xec, 0x14, 0x8b, 0xb1, 0x2c, 0x64, 0xa3, 0x6c, 0x1f, 0xe3,
-  0x46, 0x84, 0xcc, 0x8d, 0x46, 0x4b, 0x4b, 0x33, 0xba, 0xf5, 0xf5, 0x40,
-  0x1e, 0xf4, 0xdf, 0xde, 0xe9, 0x04, 0xe0, 0xd7, 0x27, 0x24, 0x70, 0xf6,
-  0xe3, 0x31, 0xee, 0xd6, 0xf1, 0x80, 0xe8, 0xe4, 0xf3, 0x9d, 0x8e, 0x8f,
-  0x18, 0x74, 0x3a, 0x03, 0x7b, 0x9e, 0x08, 0xe4, 0x4b, 0x96, 0x9b, 0xbf,
-  0x8e, 0x75, 0x64, 0x6e, 0xd2, 0x64, 0xd4, 0x56, 0xcf, 0x58, 0xf8, 0x64,
-  0xe9, 0x70, 0x39, 0x0f, 0x19, 0x81, 0x02, 0xef, 0xd8, 0x13, 0x50, 0xd9,
-  0xe5, 0xa5, 0xa5, 0x25, 0xbb, 0x7d, 0x16, 0x2e, 0x7b, 0x47, 0x29, 0x35,
-  0x65, 0x8d, 0x2f, 0x44, 0x67, 0x22, 0x41, 0x04, 0xea, 0x93, 0x0e, 0x71,
-  0x73, 0x03, 0x55, 0x85, 0x4c, 0xf6, 0x71, 0xa7, 0x4d, 0x74, 0x7c, 0x89,
-  0x3c, 0xc1, 0x65, 0x33, 0x9d, 0xbf, 0x88, 0x75, 0x56, 0xe4, 0x18, 0x77,
-  0x10, 0x24, 0x33, 0x9f, 0xc8, 0x85, 0x96, 0x0f, 0x9d, 0x04, 0xe1, 0x2c,
-  0xe5, 0x03, 0x4b, 0xb0, 0x09, 0xed, 0x23, 0xa4, 0x5a, 0xb2, 0xb7, 0xd7,
-  0xd7, 0x47, 0xf6, 0x51, 0xdb, 0xfe, 0x90, 0x53, 0x7c, 0x37, 0x16, 0x2f,
-  0xb9, 0x5e, 0x8f, 0xe8, 0xf4, 0xa1, 0xba, 0xc6, 0x63, 0x2c, 0x2a, 0x78,
-  0xb3, 0xe3, 0x47, 0x50, 0x6f, 0xf9, 0xfc, 0x24, 0x01, 0x62, 0xd1, 0xfe,
-  0x2b, 0x58, 0x7d, 0x26, 0x5f, 0x2e, 0xe5, 0x44, 0x70, 0xc4, 0x26, 0x6f,
-  0x48, 0x60, 0x38, 0x67, 0xc2, 0x07, 0x35, 0x1f, 0x58, 0x0f, 0xa0, 0x5a,
-  0x2d, 0x2d, 0x95, 0x97, 0xca, 0x76, 0x25, 0x54, 0x58, 0xf4, 0xce, 0xf1,
-  0x08, 0x4b, 0x0d, 0xde, 0x02, 0x63, 0xa7, 0x0f, 0x6a, 0xa9, 0x43, 0xf4,
-  0x7c, 0x00, 0x37, 0xc0, 0x9d, 0x89, 0x92, 0x3b, 0x80, 0x8c, 0x42, 0x51,
-  0xe6, 0x25, 0x10, 0xdc, 0x7e, 0xd7, 0xf7, 0x74, 0x2c, 0x2e, 0x9b, 0x07,
-  0xc7, 0x94, 0x4b, 0x16, 0x45, 0x73, 0x32, 0x22, 0xe6, 0x32, 0x25, 0x4c,
-  0x08, 0x14, 0x51, 0xb9, 0x93, 0x6f, 0xdb, 0xe1, 0x5d, 0x19, 0x24, 0x6a,
-  0xb6, 0x1b, 0xd7, 0xa1, 0xe8, 0x3b, 0xb3, 0xe2, 0x87, 0xe0, 0x11, 0x3d,
-  0x09, 0x65, 0x02, 0x24, 0x01, 0x42, 0x34, 0x98, 0x2d, 0x62, 0x0c, 0xc5,
-  0x35, 0x00, 0x39, 0x51, 0x8a, 0xee, 0x86, 0x91, 0x8f, 0x9e, 0x8a, 0x55,
-  0x5d, 0xce, 0xe7, 0xcb, 0xe5, 0xfc, 0x52, 0x80, 0x18, 0x26, 0x83, 0x42,
-  0x8e, 0xc9, 0xfa, 0x88, 0x25, 0x44, 0x29, 0x63, 0x01, 0xad, 0x2b, 0x72,
-  0x8a, 0x1f, 0xe7, 0x3b, 0x76, 0xc4, 0xc1, 0x04, 0x8e, 0x02, 0x58, 0xfe,
-  0xa3, 0x36, 0x14, 0x7a, 0x00, 0x95, 0x0a, 0xe4, 0x01, 0x0a, 0x1d, 0xe3,
-  0x65, 0x47, 0xd5, 0x6d, 0xdb, 0x07, 0x01, 0xfc, 0x16, 0xb4, 0x87, 0x7e,
-  0xd5, 0xfe, 0x44, 0xac, 0x84, 0x39, 0x90, 0xcf, 0x07, 0xca, 0xf9, 0x9d,
-  0x6e, 0xd7, 0x44, 0x53, 0x66, 0x8e, 0x73, 0xfa, 0x96, 0xf3, 0x18, 0x1f,
-  0x2c, 0xf4, 0x00, 0x52, 0x41, 0xeb, 0x5e, 0x42, 0x55, 0xb5, 0x07, 0x00,
-  0xad, 0x43, 0xd8, 0x03, 0xf6, 0xd9, 0x0e, 0x40, 0xd9, 0x87, 0x0e, 0xee,
-  0x9b, 0x4c, 0x26, 0x12, 0x86, 0x0b, 0x72, 0x38, 0xc0, 0xaa, 0x83, 0x60,
-  0xd9, 0x07, 0x79, 0xf8, 0xee, 0x80, 0x98, 0x64, 0x06, 0x4f, 0xc3, 0xe2,
-  0x62, 0x63, 0x30, 0x32, 0x81, 0x7c, 0xd6, 0x16, 0xdf, 0xd3, 0x5b, 0x5d,
-  0x7c, 0x6c, 0x07, 0x3a, 0xb4, 0xe4, 0x23, 0x70, 0x03, 0xe6, 0x51, 0xdf,
-  0x11, 0xa2, 0x5c, 0x6e, 0xb7, 0xa1, 0x60, 0x88, 0x1e, 0x48, 0x7a, 0xb5,
-  0x17, 0x40, 0x38, 0xd4, 0xa9, 0x40, 0x3e, 0x51, 0x3a, 0xcc, 0x66, 0xb9,
-  0xec, 0x44, 0x82, 0x78, 0x81, 0x70, 0x0c, 0xda, 0xb3, 0xa6, 0x60, 0x07,
-  0x32, 0xfc, 0xc1, 0xc1, 0xf2, 0xe5, 0xf5, 0x93, 0xb0, 0xce, 0x62, 0x0a,
-  0x41, 0x79, 0x29, 0x7f, 0x28, 0x0a, 0x5d, 0x33, 0x93, 0xe3, 0xfa, 0x25,
-  0xa8, 0x2d, 0x2c, 0x2d, 0x08, 0xd4, 0x4c, 0xdd, 0x15, 0x49, 0x1a, 0xd7,
-  0x7b, 0x89, 0x7e, 0xb5, 0xcf, 0x98, 0x19, 0x98, 0x2d, 0x24, 0x09, 0x82,
-  0x2a, 0x11, 0xe3, 0x44, 0x89, 0xdb, 0xd9, 0x11, 0x19, 0x76, 0x98, 0xbd,
-  0x21, 0x30, 0x5a, 0x0a, 0x96, 0xf2, 0x06, 0xd4, 0x50, 0x8f, 0x09, 0xd9,
-  0xfc, 0xc4, 0x92, 0xcf, 0x11, 0x50, 0x58, 0xe5, 0xf7, 0x4b, 0x4b, 0xc4,
-  0xa1, 0x54, 0x4a, 0x60, 0xb1, 0x23, 0x13, 0x56, 0x39, 0x84, 0x48, 0xd1,
-  0xa7, 0x3c, 0x7c, 0xdd, 0x57, 0x05, 0x67, 0xc5, 0x65, 0x44, 0xc6, 0x44,
-  0x4f, 0xc9, 0x1a, 0x7d, 0x7b, 0x79, 0x79, 0x75, 0x65, 0xce, 0x70, 0x99,
-  0x9d, 0x62, 0x24, 0x22, 0x98, 0x62, 0x77, 0x77, 0xb9, 0x65, 0xf8, 0xd9,
-  0x81, 0x7d, 0xd6, 0x10, 0xa0, 0x02, 0x95, 0x9f, 0x5c, 0x72, 0xde, 0x5e,
-  0x3e, 0x0d, 0xab, 0x9a, 0xc9, 0x2b, 0xb5, 0xb3, 0xf4, 0xbe, 0x9c, 0x27,
-  0xf2, 0x88, 0x94, 0x57, 0x3e, 0x05, 0x59, 0x58, 0x2f, 0x07, 0x66, 0xa1,
-  0xf2, 0xed, 0x64, 0x8a, 0x91, 0xcb, 0x8b, 0x10, 0x4d, 0x53, 0xa4, 0x5e,
-  0x53, 0xf3, 0x9f, 0x9e, 0x7a, 0x1c, 0x2e, 0x97, 0x87, 0x32, 0x05, 0x05,
-  0xb3, 0x90, 0x4c, 0x06, 0x83, 0x21, 0x53, 0x37, 0x96, 0x53, 0x02, 0xa6,
-  0x60, 0xd9, 0x47, 0x8a, 0xc0, 0x2d, 0xa1, 0xb6, 0x71, 0x4f, 0xda, 0x89,
-  0x84, 0x9b, 0x83, 0x36, 0x07, 0x4c, 0x4b, 0xef, 0xdf, 0xaf, 0x2f, 0xad,
-  0x2f, 0xd9, 0x01, 0xca, 0x5e, 0x5e, 0x5a, 0xbf, 0xbe, 0xbe, 0x5e, 0xbf,
-  0x5e, 0x02, 0xe3, 0xd0, 0x26, 0x12, 0xa5, 0xe5, 0x90, 0x89, 0xf2, 0xf8,
-  0x4f, 0x4e, 0x3e, 0x19, 0x53, 0x29, 0xed, 0x5c, 0x61, 0xcf, 0xb8, 0x5b,
-  0x28, 0x14, 0x0c, 0x9f, 0x4e, 0x3c, 0x1e, 0x17, 0x1f, 0x0c, 0x05, 0x79,
-  0x2f, 0xcf, 0x7b, 0xa7, 0xc2, 0x9d, 0x08, 0x5c, 0x00, 0x04, 0x91, 0xc2,
-  0x60, 0x3d, 0xb4, 0x77, 0xbb, 0x74, 0xf6, 0x04, 0x2c, 0xd9, 0x20, 0x94,
-  0x6e, 0xb2, 0x89, 0xf5, 0xa5, 0xf7, 0x18, 0x9f, 0x32, 0x21, 0x81, 0x10,
-  0xda, 0x97, 0xd6, 0xd7, 0xd7, 0xf1, 0xa0, 0x66, 0x1d, 0xb0, 0x02, 0xbe,
-  0x9c, 0x89, 0xda, 0x52, 0xef, 0xa5, 0xc3, 0x2b, 0x2b, 0x61, 0xad, 0x56,
-  0x7b, 0xac, 0x52, 0xa9, 0xb6, 0x55, 0xc7, 0xe1, 0x70, 0x18, 0x00, 0x37,
-  0xb7, 0x74, 0x6e, 0x9b, 0xd7, 0x6a, 0xb5, 0x51, 0x94, 0x17, 0x22, 0x37,
-  0xec, 0xd9, 0x51, 0x41, 0x46, 0x9d, 0x00, 0x88, 0x07, 0xfc, 0x73, 0xed,
-  0xb1, 0xaf, 0x1d, 0x08, 0x2c, 0x8f, 0x1e, 0x8f, 0x15, 0xbc, 0xcd, 0x4d,
-  0x9c, 0xac, 0x25, 0x97, 0xc7, 0xb2, 0xc7, 0x16, 0x8b, 0x48, 0x10, 0x2c,
-  0x7c, 0x84, 0x8d, 0x46, 0x8c, 0x5b, 0x36, 0xc3, 0x81, 0x76, 0x7b, 0xf5,
-  0xf5, 0xea, 0xea, 0xe2, 0xca, 0xca, 0xca, 0x9b, 0xc5, 0x37, 0x2b, 0x6f,
-  0xde, 0xbc, 0x59, 0x5c, 0x5d, 0xc4, 0x8f, 0x54, 0x5a, 0xe3, 0xa6, 0x7a,
-  0xcb, 0xe1, 0x76, 0x5b, 0xad, 0x56, 0x2f, 0x1f, 0x9c, 0x9a, 0xd9, 0x1b,
-  0x50, 0x15, 0x08, 0xd5, 0x60, 0x69, 0x04, 0xf5, 0x6a, 0x5f, 0x97, 0x6a,
-  0x20, 0xd4, 0x79, 0x96, 0x78, 0x2c, 0xd6, 0x58, 0x2e, 0xe5, 0xc0, 0x57,
-  0x32, 0xcc, 0xe1, 0x61, 0x1e, 0x15, 0xf4, 0xfd, 0x35, 0x20, 0xbd, 0x5f,
-  0x47, 0xa8, 0xa5, 0x40, 0xa2, 0xe4, 0x6c, 0xf1, 0xa9, 0xed, 0xb5, 0x85,
-  0xf9, 0xf9, 0x97, 0x2f, 0x5f, 0xce, 0xaf, 0xbd, 0x7d, 0xfb, 0x76, 0x6d,
-  0x0d, 0xdf, 0xd6, 0xd6, 0x16, 0x7e, 0xf9, 0x65, 0xe1, 0xed, 0xe2, 0xbe,
-  0x6a, 0xfb, 0x60, 0x57, 0xad, 0x81, 0x3a, 0xb3, 0x92, 0x36, 0xca, 0x4b,
-  0x0b, 0xcc, 0x30, 0xa1, 0xd4, 0x7b, 0x7b, 0x54, 0x56, 0x9a, 0x56, 0xbb,
-  0x2a, 0x66, 0x61, 0xe6, 0xe6, 0xda, 0x8f, 0xc4, 0x12, 0x9d, 0xb9, 0x58,
-  0x22, 0xe0, 0x14, 0x51, 0x24, 0xa0, 0xbc, 0xce, 0xde, 0x9f, 0xe1, 0xc2,
-  0xc2, 0x02, 0xcd, 0x77, 0x72, 0x17, 0xa7, 0xc7, 0xf3, 0xbf, 0xfd, 0xf2,
-  0xcb, 0xfc, 0x6f, 0x88, 0x35, 0xff, 0x0b, 0xac, 0x85, 0xb5, 0x05, 0x40,
-  0xfa, 0x65, 0x1e, 0xd6, 0xda, 0x5b, 0x08, 0xe0, 0x76, 0x3a, 0xa5, 0xd6,
-  0x3b, 0x74, 0x2e, 0x97, 0xc3, 0x63, 0xe5, 0xc1, 0xb0, 0x39, 0x3b, 0xc8,
-  0x05, 0x81, 0x2f, 0x83, 0x1b, 0x82, 0x2d, 0x63, 0x77, 0x46, 0x60, 0x13,
-  0x65, 0x8e, 0x1e, 0x85, 0x75, 0x64, 0x1e, 0x5a, 0xc0, 0xb1, 0x95, 0xed,
-  0x90, 0x3c, 0xc4, 0x7a, 0x3f, 0xc3, 0x82, 0x60, 0x95, 0xf3, 0xd2, 0x32,
-  0xc3, 0x7f, 0x5a, 0x9d, 0x57, 0xd6, 0x4b, 0x65, 0xcd, 0xff, 0xf3, 0x02,
-  0xac, 0xfd, 0x15, 0xd5, 0x81, 0x31, 0xbe, 0xe1, 0xf7, 0xe8, 0x74, 0x0e,
-  0x87, 0xcb, 0x46, 0xf1, 0xc9, 0x0c, 0x81, 0xfa, 0x00, 0x54, 0x76, 0xc0,
-  0xc2, 0xd6, 0xd0, 0x21, 0x02, 0x81, 0xf1, 0xa4, 0xfa, 0x28, 0xac, 0xba,
-  0x59, 0x2a, 0x97, 0x96, 0x7d, 0x5c, 0xa9, 0x1c, 0xc8, 0x03, 0xd5, 0xd2,
-  0x3a, 0x62, 0x5d, 0xc3, 0xff, 0x66, 0x9e, 0xc8, 0x32, 0x16, 0x4d, 0x78,
-  0xe1, 0xe5, 0x8c, 0xe8, 0xa7, 0x97, 0x7f, 0x80, 0xfd, 0x89, 0x6e, 0x61,
-  0xed, 0x2d, 0x44, 0x4b, 0xbb, 0x9b, 0xda, 0xd8, 0xf2, 0x78, 0x3c, 0x0e,
-  0x9d, 0xce, 0x45, 0x92, 0xde, 0x8b, 0x3e, 0x4c, 0x44, 0x6d, 0x28, 0xac,
-  0x01, 0x16, 0xd7, 0x6c, 0x0c, 0xc8, 0xf7, 0x86, 0x97, 0x47, 0x8f, 0xc1,
-  0xe2, 0x6e, 0xf3, 0x23, 0x1f, 0x8c, 0x59, 0x12, 0xf6, 0x17, 0xa8, 0xd2,
-  0x75, 0x0c, 0x55, 0xb9, 0x7c, 0x1d, 0x28, 0xed, 0xc4, 0xa6, 0x1b, 0x2b,
-  0xaf, 0x16, 0x80, 0x68, 0xb6, 0x14, 0xb8, 0x3f, 0xe8, 0x66, 0x84, 0x0b,
-  0x0b, 0xaf, 0x17, 0x57, 0x8e, 0x0f, 0x8c, 0x33, 0x2c, 0x8f, 0x03, 0xc0,
-  0xdc, 0xb6, 0x60, 0xab, 0x37, 0x50, 0x76, 0x23, 0xfc, 0x6b, 0x28, 0xa8,
-  0x6d, 0xd8, 0x46, 0x44, 0x95, 0xee, 0x9e, 0x3d, 0x2a, 0x89, 0x19, 0x88,
-  0xf7, 0x08, 0x9a, 0x6f, 0x19, 0x0c, 0xc1, 0x19, 0x6c, 0x1d, 0xc4, 0x82,
-  0x0d, 0x7e, 0x23, 0xf3, 0x7e, 0xe3, 0xc2, 0xab, 0x57, 0xf3, 0x7f, 0x50,
-  0xfd, 0xdf, 0x58, 0xaf, 0x5e, 0xad, 0xbd, 0xde, 0x5f, 0xd9, 0x0e, 0xef,
-  0xa6, 0xd4, 0x51, 0xbf, 0x63, 0xc6, 0xd5, 0xd0, 0x91, 0x94, 0xd0, 0x1f,
-  0x28, 0x55, 0xaf, 0xe8, 0x0d, 0xe6, 0x10, 0x5a, 0x29, 0x73, 0xf4, 0xb8,
-  0x92, 0xb7, 0x0f, 0xdb, 0xb8, 0x93, 0x61, 0x0c, 0x2c, 0x2b, 0x9a, 0xa0,
-  0xac, 0x72, 0xde, 0x79, 0xbb, 0x65, 0x54, 0xad, 0x21, 0xd6, 0x4f, 0x3f,
-  0xff, 0xfc, 0xd3, 0x9f, 0xd6, 0x9f, 0xa3, 0xb5, 0xb0, 0xb6, 0xb8, 0xa2,
-  0x0a, 0x6b, 0x0b, 0x9f, 0xa2, 0x5b, 0x7e, 0x80, 0xd2, 0xe0, 0x83, 0xa3,
-  0x46, 0x4e, 0x59, 0x6c, 0x41, 0x65, 0x2c, 0x55, 0x7b, 0x00, 0xac, 0x18,
-  0xe8, 0x60, 0xb9, 0xfa, 0xc8, 0x9d, 0x98, 0x99, 0x0c, 0xb0, 0xed, 0x95,
-  0x61, 0x5c, 0x00, 0xe1, 0x42, 0x59, 0x80, 0xd0, 0x8f, 0x87, 0xa6, 0x3d,
-  0x40, 0x02, 0x28, 0x0c, 0xd6, 0x7f, 0x81, 0xf5, 0xea, 0xf5, 0xeb, 0x55,
-  0xd0, 0xad, 0x39, 0xe3, 0x66, 0x74, 0x4b, 0xe3, 0x71, 0x00, 0x95, 0xdf,
-  0xaf, 0xd1, 0x78, 0x74, 0x35, 0x0a, 0x07, 0x5b, 0x74, 0x8e, 0xa0, 0x7a,
-  0xd0, 0xcd, 0x02, 0x38, 0x60, 0x76, 0xc4, 0x47, 0x61, 0x75, 0x48, 0xa9,
-  0x6d, 0x07, 0x1a, 0xf4, 0x78, 0xe3, 0x3c, 0x28, 0xe1, 0x3a, 0x98, 0xbe,
-  0xc4, 0x0e, 0xa5, 0x5e, 0x79, 0xf5, 0xb0, 0xfb, 0xfe, 0x39, 0x42, 0x4a,
-  0xee, 0xf0, 0x5b, 0xf3, 0x2f, 0x17, 0x56, 0xf7, 0xf7, 0x55, 0xc7, 0x69,
-  0x90, 0x53, 0xbd, 0x1f, 0xd2, 0xe7, 0xf1, 0x23, 0x16, 0xd4, 0xbd, 0x9b,
-  0x8a, 0x38, 0x09, 0x74, 0xa7, 0x0f, 0x2b, 0x80, 0xb6, 0xc8, 0xde, 0xab,
-  0x3e, 0xa6, 0xb6, 0x64, 0x4b, 0x67, 0xa4, 0xb4, 0xbf, 0x6b, 0xd8, 0x81,
-  0x20, 0x55, 0xc0, 0xd5, 0x91, 0x62, 0x9e, 0xc2, 0xfe, 0xc2, 0x3f, 0xb0,
-  0xfe, 0x15, 0x0a, 0xd6, 0xc2, 0xab, 0x85, 0x85, 0x35, 0x10, 0x87, 0xed,
-  0x83, 0x73, 0x43, 0x5c, 0xbf, 0x85, 0x38, 0x1a, 0xff, 0x96, 0x7e, 0x0b,
-  0xa9, 0x5c, 0x5e, 0x81, 0x1d, 0x03, 0x16, 0xc8, 0x16, 0x6e, 0x45, 0xc5,
-  0x6b, 0xa3, 0x83, 0xae, 0x3a, 0x1f, 0x91, 0xc4, 0x21, 0x7a, 0x5f, 0xa0,
-  0x02, 0x28, 0x14, 0x06, 0x10, 0x2f, 0x27, 0xbf, 0x55, 0x50, 0xbd, 0x5a,
-  0x78, 0x50, 0xaa, 0x7f, 0xc5, 0x5a, 0x50, 0x92, 0xbb, 0xb0, 0xa0, 0x60,
-  0x41, 0x0a, 0xbf, 0x6e, 0x9e, 0xe8, 0x81, 0x0b, 0x96, 0x5e, 0x1f, 0x8d,
-  0x6a, 0x1c, 0x0e, 0x77, 0xa5, 0xd9, 0x15, 0x61, 0x88, 0x2b, 0xcf, 0x56,
-  0xe7, 0x0f, 0x13, 0x6b, 0xef, 0xb4, 0xfa, 0x47, 0xdf, 0x9d, 0x44, 0xe7,
-  0x3a, 0x70, 0x29, 0x58, 0x18, 0x2d, 0x70, 0x0f, 0x3e, 0x53, 0x74, 0x77,
-  0x65, 0x0d, 0x4a, 0x7d, 0x96, 0xbd, 0x7f, 0x4d, 0x21, 0x02, 0x41, 0x20,
-  0x01, 0x0c, 0x76, 0x61, 0x78, 0x77, 0xef, 0x6b, 0xea, 0xdb, 0xb7, 0xa8,
-  0x5e, 0x7f, 0x7a, 0x7a, 0x1a, 0x3d, 0x89, 0x62, 0x36, 0xc9, 0x4a, 0x73,
-  0x2a, 0xdf, 0xe4, 0x61, 0x33, 0x96, 0x15, 0x1e, 0xfb, 0xec, 0x01, 0xac,
-  0x2a, 0x21, 0x9f, 0x7d, 0x27, 0xd6, 0x91, 0x58, 0x1e, 0xa1, 0x30, 0xcc,
-  0xa0, 0xae, 0x61, 0x43, 0x96, 0xcc, 0x9e, 0xdd, 0xfd, 0xd7, 0x6b, 0xaf,
-  0x5e, 0xfe, 0x33, 0xd6, 0xab, 0x57, 0x0f, 0xbb, 0xef, 0xd5, 0x1f, 0x58,
-  0xb3, 0x60, 0x19, 0xcf, 0x53, 0xdf, 0xd4, 0x27, 0x27, 0xd1, 0x28, 0x80,
-  0x41, 0xb4, 0xfc, 0xd8, 0x1c, 0xbd, 0x53, 0x33, 0x14, 0xd7, 0x83, 0xa9,
-  0x41, 0x22, 0x3c, 0xd7, 0x81, 0x78, 0xf9, 0x2e, 0xbf, 0x37, 0x89, 0x7d,
-  0x14, 0xbe, 0xf5, 0xa5, 0x59, 0xac, 0xca, 0x4b, 0xe0, 0x17, 0xb2, 0xd6,
-  0xb9, 0xd7, 0xaf, 0x41, 0x19, 0x5e, 0xfe, 0x7d, 0xdb, 0x29, 0xc5, 0xf4,
-  0x20, 0xf3, 0x4a, 0xf6, 0x1e, 0xb0, 0x5e, 0xef, 0xab, 0xc2, 0x07, 0x85,
-  0xf3, 0x4f, 0x88, 0x75, 0xa2, 0x8e, 0x9e, 0x9e, 0x42, 0x22, 0x61, 0x1f,
-  0xd6, 0xac, 0x7c, 0x28, 0x52, 0x25, 0x94, 0xdc, 0x95, 0x1f, 0x8a, 0x5e,
-  0xf9, 0xdb, 0xee, 0xdf, 0x7c, 0x2f, 0x16, 0x3b, 0x6a, 0xcf, 0x2a, 0x0b,
-  0x8b, 0x1e, 0xa6, 0x1c, 0x42, 0x62, 0xfc, 0xe1, 0x7f, 0x8f, 0xf5, 0xf3,
-  0x4f, 0x8a, 0x54, 0xbd, 0x7e, 0x8d, 0x62, 0x36, 0x3f, 0x2b, 0x79, 0x10,
-  0xad, 0xf4, 0x5c, 0xe1, 0xdc, 0xf0, 0xed, 0x1b, 0x60, 0xf9, 0x71, 0x3f,
-  0xd6, 0x5c, 0x2e, 0x8a, 0x36, 0x45, 0xaa, 0x63, 0xf0, 0xce, 0xca, 0x24,
-  0xde, 0xfe, 0xfb, 0x86, 0x94, 0x7a, 0x67, 0xdf, 0x8b, 0x35, 0x01, 0xbf,
-  0x77, 0x5d, 0xce, 0x2b, 0x96, 0x01, 0xac, 0x69, 0x60, 0xcc, 0x09, 0xf1,
-  0xf0, 0xfe, 0x2a, 0xfc, 0xea, 0x3f, 0xd7, 0xd3, 0xfc, 0x4c, 0xec, 0x91,
-  0x6a, 0x61, 0x75, 0x15, 0xda, 0xd1, 0xfc, 0x43, 0x3a, 0xd7, 0x56, 0x57,
-  0xdf, 0xa8, 0xb4, 0x1f, 0x3f, 0xec, 0x19, 0xbe, 0x9d, 0xe8, 0x4f, 0x41,
-  0x4b, 0xdd, 0x98, 0x43, 0x3a, 0x59, 0xe4, 0xc6, 0x03, 0xc5, 0x49, 0x2e,
-  0x61, 0x6f, 0x54, 0x12, 0xd9, 0x0e, 0xdc, 0x7c, 0xbf, 0x40, 0x48, 0xed,
-  0x25, 0x8c, 0x92, 0x92, 0xc3, 0xf7, 0x60, 0xdc, 0xc7, 0x19, 0x7e, 0x4f,
-  0xbb, 0x82, 0xb5, 0x35, 0xff, 0xcf, 0x95, 0x8e, 0xaa, 0x8a, 0x05, 0xbf,
-  0x06, 0xc8, 0xff, 0x10, 0x0e, 0x40, 0x7b, 0x0d, 0x56, 0x30, 0xfc, 0x71,
-  0xae, 0x60, 0x38, 0xd1, 0xe3, 0x36, 0x04, 0x37, 0x48, 0xd1, 0xc9, 0x48,
-  0x66, 0x6c, 0x07, 0x73, 0xfa, 0xfe, 0xbd, 0x32, 0x10, 0x28, 0xee, 0x39,
-  0x91, 0xb9, 0xed, 0x7c, 0x37, 0xd6, 0xa4, 0x3d, 0x4b, 0xa1, 0xc2, 0xb5,
-  0x04, 0xb3, 0x73, 0x86, 0x32, 0x6a, 0x55, 0x2b, 0xff, 0x1a, 0x2e, 0x48,
-  0xe1, 0x6c, 0x61, 0x71, 0xcd, 0xff, 0xd1, 0xbc, 0x95, 0x8d, 0xf9, 0x16,
-  0xb0, 0xb6, 0xc3, 0xe9, 0x0f, 0x85, 0x94, 0xda, 0x0f, 0xa6, 0x0b, 0xb0,
-  0x6c, 0x80, 0x55, 0xef, 0x41, 0x71, 0x8d, 0xd6, 0xdf, 0x2f, 0x29, 0xd2,
-  0x85, 0xa7, 0x17, 0x2d, 0xe2, 0xcc, 0xfe, 0xdd, 0x58, 0xa3, 0x61, 0xe0,
-  0xef, 0xea, 0x70, 0x5d, 0x46, 0x2c, 0xfa, 0x53, 0x7a, 0x7b, 0x16, 0xae,
-  0xf9, 0xf9, 0x59, 0x48, 0x14, 0x04, 0x64, 0xfa, 0xfc, 0xf9, 0xf3, 0x4f,
-  0x2f, 0x95, 0x2f, 0xce, 0x18, 0x7f, 0x42, 0x48, 0xe8, 0x8a, 0xe0, 0xea,
-  0xb5, 0xe9, 0xc2, 0x79, 0x1c, 0xe4, 0xc1, 0xed, 0x02, 0x53, 0x4f, 0x87,
-  0x04, 0xc6, 0x47, 0x74, 0xda, 0xe8, 0x6f, 0xdf, 0x2b, 0x87, 0x2a, 0xe0,
-  0x6f, 0x86, 0x8f, 0x6a, 0x3e, 0x03, 0x41, 0x1c, 0x5d, 0x2b, 0x6b, 0x7d,
-  0x1d, 0xba, 0x04, 0x91, 0x15, 0xfc, 0x7b, 0x07, 0xdb, 0xaa, 0x7d, 0x2c,
-  0xec, 0x87, 0x82, 0x7a, 0xa0, 0xf8, 0xe9, 0xf3, 0xbb, 0x77, 0x9f, 0x91,
-  0xe5, 0xa7, 0xbf, 0x63, 0xbd, 0x5a, 0x45, 0x17, 0xb8, 0x8d, 0x63, 0x87,
-  0xb6, 0xb0, 0xb7, 0xb9, 0x01, 0x5c, 0x3a, 0x37, 0x49, 0xf1, 0xf4, 0x34,
-  0x36, 0xe9, 0xb4, 0x47, 0xd7, 0x67, 0x4b, 0xb3, 0x85, 0x01, 0x63, 0x1f,
-  0xe9, 0x20, 0x74, 0x12, 0x54, 0x3d, 0xf6, 0x9d, 0xf5, 0xf2, 0x3a, 0xcc,
-  0xd5, 0x11, 0x47, 0x7c, 0x37, 0x0c, 0x58, 0xb0, 0x19, 0x15, 0x5b, 0xf3,
-  0x8f, 0xe0, 0xfc, 0xfc, 0x19, 0xb1, 0x1e, 0xf2, 0xa9, 0x6c, 0xcb, 0xb5,
-  0xc5, 0xfd, 0xed, 0xe3, 0xe3, 0xf0, 0xc1, 0xc1, 0x01, 0xec, 0x47, 0x63,
-  0x5c, 0xe9, 0xd8, 0x98, 0x47, 0xef, 0x34, 0xc9, 0x12, 0xb3, 0x1c, 0x82,
-  0xdb, 0x45, 0x27, 0x41, 0xd4, 0x89, 0x47, 0x7a, 0x79, 0xe2, 0xa2, 0x83,
-  0x43, 0xc5, 0x92, 0x32, 0xed, 0x04, 0x7c, 0x32, 0xb5, 0x05, 0xe1, 0xfa,
-  0xb7, 0x58, 0x0a, 0xcd, 0x43, 0xa7, 0x44, 0x01, 0x53, 0xad, 0x40, 0xb5,
-  0x1f, 0xa4, 0x77, 0x8d, 0x7b, 0xe7, 0x46, 0x08, 0x56, 0xc3, 0xa5, 0x03,
-  0x1b, 0xa8, 0x73, 0xbb, 0xdd, 0x24, 0x3d, 0xbd, 0xf3, 0xa1, 0x9f, 0x87,
-  0x1c, 0x2a, 0x58, 0xeb, 0x99, 0xd1, 0xa3, 0x07, 0xb2, 0x3e, 0x56, 0xe4,
-  0x12, 0x8e, 0x14, 0x50, 0x5e, 0xa5, 0x1c, 0xed, 0x30, 0xcc, 0x69, 0x55,
-  0xfb, 0xab, 0x6b, 0x8a, 0x6c, 0xce, 0x9c, 0xcd, 0x9f, 0xa8, 0x60, 0x08,
-  0x02, 0xda, 0x07, 0x35, 0xc5, 0x41, 0x16, 0xe6, 0x0b, 0x34, 0x34, 0x0e,
-  0x17, 0xdf, 0x35, 0xd1, 0x56, 0x57, 0xcd, 0x5d, 0xd3, 0x81, 0x74, 0x25,
-  0x39, 0x10, 0x6a, 0x85, 0x0a, 0xb1, 0xae, 0xc5, 0xc7, 0xcf, 0x89, 0xbd,
-  0xc1, 0x18, 0x7c, 0xda, 0x3a, 0xce, 0xd0, 0xeb, 0x4b, 0x04, 0x1b, 0x21,
-  0xe3, 0x05, 0xd8, 0x8c, 0x18, 0x2f, 0x25, 0x30, 0x7f, 0x86, 0x02, 0x81,
-  0xd8, 0x5f, 0x05, 0x91, 0x58, 0x84, 0x29, 0x71, 0x25, 0x9c, 0x06, 0xb3,
-  0xec, 0xf1, 0xe8, 0xac, 0x74, 0x37, 0x99, 0xbc, 0x8d, 0x99, 0x45, 0x76,
-  0x98, 0x33, 0x5b, 0x9a, 0x2e, 0x37, 0x89, 0x22, 0x21, 0x42, 0x71, 0x01,
-  0x14, 0x8e, 0x07, 0xb0, 0x19, 0xd9, 0xc7, 0x63, 0x55, 0xfb, 0x12, 0x4e,
-  0xd1, 0xb3, 0xba, 0xcf, 0x1f, 0xee, 0x78, 0x37, 0x8c, 0xda, 0x6d, 0xd5,
-  0xca, 0xe2, 0xeb, 0x57, 0xff, 0xd8, 0x84, 0x50, 0x58, 0x50, 0x56, 0xa0,
-  0x9f, 0xfb, 0xfb, 0x8b, 0xfb, 0x30, 0xc3, 0x42, 0xa1, 0x1f, 0x14, 0x52,
-  0x7a, 0x0f, 0x1d, 0x83, 0x01, 0x53, 0xac, 0x8b, 0xb9, 0x4c, 0x75, 0x98,
-  0x19, 0x56, 0x87, 0x52, 0xaf, 0x6e, 0x69, 0x56, 0xac, 0x15, 0x5b, 0xb3,
-  0x48, 0x60, 0xb4, 0x70, 0x41, 0xc9, 0x0f, 0x9f, 0x30, 0x55, 0x1f, 0xb1,
-  0xa0, 0x7d, 0xb8, 0x13, 0xdf, 0x43, 0xe5, 0xdb, 0x13, 0x2c, 0x15, 0x05,
-  0x2c, 0x14, 0x89, 0x85, 0xf9, 0x3f, 0xa0, 0x3e, 0x2b, 0x50, 0xaf, 0x21,
-  0x44, 0xc7, 0xdb, 0x90, 0x3a, 0x9c, 0xf4, 0xb5, 0x85, 0xb8, 0x9f, 0x32,
-  0x31, 0xcb, 0x04, 0x1e, 0xa5, 0xe0, 0x83, 0xc4, 0xb1, 0xf5, 0x89, 0xd4,
-  0x1b, 0xfb, 0x72, 0x53, 0x6f, 0x93, 0xa2, 0x22, 0x63, 0x68, 0xb6, 0x0f,
-  0x58, 0x04, 0xf1, 0x94, 0x13, 0x9b, 0x49, 0x27, 0xd0, 0x9e, 0x89, 0x04,
-  0xcc, 0x3c, 0x25, 0x96, 0x8e, 0x2a, 0xd1, 0x82, 0x6c, 0x41, 0xb8, 0x30,
-  0x4a, 0x3f, 0xad, 0x42, 0xc2, 0x0a, 0x9b, 0x90, 0x5b, 0xed, 0xdc, 0xee,
-  0xdc, 0xdc, 0xee, 0xee, 0x01, 0x08, 0xc2, 0x5c, 0x4a, 0xef, 0x0a, 0x0a,
-  0x39, 0xce, 0x97, 0x20, 0xf2, 0x9d, 0xce, 0x80, 0x20, 0xc6, 0x93, 0xfa,
-  0x70, 0x58, 0x9d, 0x38, 0xa5, 0xc9, 0x65, 0x88, 0x6e, 0x52, 0x82, 0x0f,
-  0xfc, 0xd2, 0x7b, 0x2c, 0xae, 0xf5, 0xeb, 0xc3, 0xf5, 0xa7, 0x60, 0x8d,
-  0x13, 0x01, 0x25, 0x89, 0x60, 0x24, 0xb0, 0xe6, 0x6d, 0xb3, 0x24, 0x62,
-  0x97, 0x59, 0x00, 0xef, 0x02, 0x9b, 0x5f, 0x4d, 0x17, 0xc5, 0xfa, 0x44,
-  0x9c, 0xba, 0xf5, 0xf1, 0x78, 0xaa, 0x60, 0x3c, 0x37, 0x02, 0xdd, 0xde,
-  0xc6, 0x96, 0x0b, 0xac, 0x02, 0xe4, 0x30, 0x33, 0x99, 0x54, 0xeb, 0xf0,
-  0x50, 0x6f, 0x31, 0xe6, 0x08, 0x53, 0x1f, 0x72, 0x99, 0x08, 0x44, 0x2b,
-  0x29, 0x29, 0x58, 0xb0, 0xca, 0xeb, 0x3b, 0x47, 0x4f, 0xc1, 0x5a, 0xef,
-  0xdb, 0xed, 0xca, 0x56, 0x04, 0x33, 0xb1, 0x54, 0x8a, 0xe8, 0xd4, 0xbb,
-  0x80, 0xb5, 0xf8, 0x7a, 0x61, 0x5f, 0xbb, 0xb9, 0xe5, 0xa1, 0xae, 0x04,
-  0xb3, 0xd8, 0x87, 0x24, 0x8d, 0x9d, 0xb9, 0x08, 0xef, 0xd0, 0xc7, 0xf7,
-  0x52, 0x86, 0xcd, 0xf3, 0x94, 0x01, 0x66, 0x30, 0x97, 0x37, 0x18, 0x9c,
-  0x86, 0x92, 0xb1, 0xe2, 0x9d, 0xc5, 0x62, 0x89, 0x59, 0x82, 0x4d, 0x3a,
-  0x64, 0xba, 0x6d, 0xd5, 0xeb, 0x22, 0x63, 0xf2, 0x52, 0xd3, 0x3e, 0x14,
-  0x86, 0x42, 0x95, 0x5f, 0xca, 0x3d, 0xed, 0x34, 0xb0, 0xaa, 0x5c, 0x35,
-  0x01, 0x3b, 0x08, 0x02, 0xe8, 0x4b, 0x7a, 0x8c, 0x07, 0xda, 0xed, 0x95,
-  0xd5, 0x85, 0x03, 0xb5, 0xce, 0xc6, 0xc7, 0xd8, 0x49, 0x7f, 0xac, 0x9c,
-  0xbb, 0xf7, 0x45, 0x59, 0xf0, 0x56, 0x1c, 0xd1, 0x3d, 0x83, 0x5a, 0xbd,
-  0x01, 0x3e, 0x54, 0x03, 0x13, 0x21, 0x4d, 0xd3, 0x41, 0x53, 0x32, 0x69,
-  0x0a, 0xc2, 0xe2, 0x29, 0xaa, 0x89, 0x9f, 0x77, 0x2d, 0xe6, 0x3b, 0x81,
-  0xae, 0xf0, 0x13, 0xf8, 0xf7, 0x10, 0x2b, 0x9f, 0x4f, 0x14, 0x9f, 0x86,
-  0x55, 0xaf, 0xe2, 0xf9, 0xff, 0x12, 0xfe, 0x2b, 0x4b, 0x87, 0xc1, 0xad,
-  0x39, 0xe8, 0x3e, 0xaa, 0xfd, 0x5d, 0x07, 0x3f, 0x4d, 0xe6, 0x86, 0xce,
-  0xde, 0xb8, 0x77, 0x23, 0xf5, 0xeb, 0x39, 0x19, 0xe3, 0x51, 0x71, 0xfb,
-  0x21, 0x4e, 0x1b, 0x08, 0xe5, 0x76, 0x55, 0x28, 0x1a, 0xa2, 0x65, 0x4a,
-  0x42, 0x29, 0x55, 0xac, 0x24, 0x09, 0x83, 0xbe, 0x0d, 0x36, 0x61, 0x33,
-  0x68, 0x11, 0x42, 0x34, 0xc5, 0x57, 0x67, 0x58, 0x01, 0x67, 0xd6, 0x74,
-  0xf6, 0xc4, 0x03, 0xf0, 0x23, 0x5f, 0x0f, 0xa2, 0x05, 0x42, 0x7f, 0xbd,
-  0xbe, 0x4c, 0xc5, 0xe7, 0x0e, 0xc2, 0xdb, 0xdb, 0x9b, 0x6e, 0x5a, 0xce,
-  0x4d, 0x7c, 0x37, 0x37, 0x37, 0xbe, 0xaa, 0xc8, 0x30, 0x77, 0x49, 0x93,
-  0x29, 0x44, 0xd3, 0x4d, 0x52, 0xa3, 0x06, 0x6b, 0xac, 0xab, 0xb9, 0x2a,
-  0xa0, 0x4d, 0xc1, 0x50, 0x12, 0x56, 0xc8, 0xea, 0xd0, 0xc0, 0xf2, 0xc3,
-  0xdc, 0xa3, 0x23, 0x2b, 0x14, 0xa6, 0x72, 0x4a, 0x53, 0x54, 0xbd, 0x8d,
-  0x58, 0x67, 0x81, 0x1c, 0x37, 0x78, 0xfa, 0x55, 0x8c, 0x7a, 0xf5, 0x0c,
-  0x0f, 0x28, 0xaf, 0xd7, 0xab, 0x15, 0xc3, 0x5c, 0x5a, 0xbb, 0x9d, 0xaa,
-  0x84, 0xcc, 0x45, 0x33, 0x23, 0x0e, 0xab, 0x19, 0x31, 0x66, 0x0a, 0x85,
-  0xa6, 0x34, 0x1d, 0x0a, 0x05, 0x83, 0xb4, 0x4d, 0xb7, 0xe5, 0x69, 0x38,
-  0x6a, 0x6e, 0xab, 0xcd, 0xd6, 0xa4, 0xa7, 0x5d, 0xc1, 0xd2, 0xc5, 0x43,
-  0xd3, 0x08, 0x14, 0x97, 0x40, 0xf3, 0x64, 0xc3, 0x81, 0x67, 0x23, 0x90,
-  0x4a, 0xaf, 0xcd, 0x26, 0xda, 0x11, 0xab, 0x4c, 0x30, 0xbd, 0x4c, 0x7d,
-  0xfc, 0xe4, 0x6b, 0x3e, 0x97, 0x81, 0x6b, 0xe5, 0x72, 0x49, 0xbd, 0xf1,
-  0x15, 0xb0, 0xe6, 0x34, 0x74, 0x24, 0x62, 0x36, 0xc7, 0x2c, 0x11, 0x4b,
-  0xd2, 0xd4, 0x74, 0x91, 0x2e, 0x77, 0x65, 0x9a, 0xbc, 0x4d, 0x76, 0x69,
-  0xaf, 0xbb, 0x06, 0x9f, 0xb8, 0x5c, 0x4a, 0x58, 0xa6, 0x00, 0x14, 0x11,
-  0x25, 0xa9, 0x1e, 0x13, 0x22, 0x91, 0xcb, 0x16, 0x5b, 0x97, 0xbd, 0x3a,
-  0xe8, 0x3c, 0x3c, 0x4f, 0x7b, 0xad, 0x56, 0x06, 0x1a, 0xc7, 0x92, 0x89,
-  0xf6, 0x65, 0x65, 0xda, 0xe6, 0x32, 0x3f, 0x15, 0xab, 0x5d, 0xcf, 0xe3,
-  0xe9, 0xc3, 0x48, 0x8c, 0x1a, 0xe7, 0xd2, 0x07, 0x9b, 0x1a, 0x8a, 0x9f,
-  0x5a, 0x22, 0x02, 0xed, 0xd6, 0xc1, 0x58, 0x0a, 0x73, 0x4d, 0xa3, 0x12,
-  0x82, 0x80, 0x74, 0x69, 0xbe, 0x42, 0x5a, 0x5d, 0x6e, 0x77, 0xcd, 0x0d,
-  0x5c, 0xb4, 0x49, 0xb8, 0xbb, 0x1c, 0xf6, 0x7a, 0xce, 0xea, 0xa4, 0x07,
-  0x92, 0x3a, 0x9e, 0xb0, 0x99, 0xaa, 0xec, 0x05, 0x5e, 0x9e, 0xe6, 0x6d,
-  0xd6, 0x98, 0x1d, 0x5a, 0x99, 0xae, 0x38, 0x89, 0x50, 0x5e, 0x99, 0xa1,
-  0x62, 0x4f, 0xbe, 0x9e, 0xc8, 0x9d, 0x61, 0xb4, 0x98, 0x4d, 0x54, 0x4c,
-  0xb5, 0x03, 0x77, 0x59, 0x45, 0xb7, 0x61, 0x2c, 0xa4, 0xd3, 0xbb, 0x7b,
-  0x7a, 0x77, 0x30, 0x99, 0xb4, 0x44, 0x22, 0x96, 0x2e, 0x4d, 0xba, 0x81,
-  0x54, 0xe3, 0xa9, 0x41, 0xbc, 0xc0, 0x85, 0x9a, 0x5b, 0xfd, 0x5e, 0x67,
-  0xb4, 0x7e, 0x86, 0x37, 0xea, 0x8d, 0x07, 0xa3, 0x8e, 0xcf, 0xc9, 0xfc,
-  0xce, 0xc3, 0x4f, 0xf2, 0x5e, 0x92, 0x27, 0x46, 0x44, 0x3e, 0x91, 0x8d,
-  0x91, 0x54, 0x8c, 0x3d, 0xcc, 0xd8, 0x86, 0x4f, 0xc5, 0x1a, 0xf9, 0xf0,
-  0xe4, 0x5a, 0x4e, 0xcd, 0x01, 0x87, 0xda, 0xe5, 0xa5, 0x6d, 0x9e, 0xb8,
-  0x31, 0x7d, 0x50, 0x80, 0xc0, 0xdd, 0x32, 0xdc, 0x8d, 0xef, 0xb0, 0x2e,
-  0xcb, 0x91, 0x5b, 0xda, 0xa5, 0x6b, 0x6c, 0x6d, 0x6d, 0xa1, 0xdf, 0xab,
-  0x04, 0x05, 0xf3, 0xa5, 0x2c, 0xc1, 0x58, 0xaa, 0x8c, 0x99, 0x03, 0x91,
-  0x58, 0x3f, 0x6b, 0x13, 0x93, 0xba, 0xd9, 0x44, 0x43, 0x16, 0x29, 0xde,
-  0x67, 0xf7, 0xf9, 0x32, 0x31, 0x1b, 0xc9, 0x27, 0x8b, 0x59, 0xdf, 0xdd,
-  0x97, 0x27, 0x5f, 0x14, 0xee, 0x05, 0x40, 0xbe, 0x8a, 0x7b, 0xbb, 0xe9,
-  0xb4, 0x51, 0xed, 0x70, 0xbb, 0x35, 0x9b, 0x73, 0xda, 0x82, 0x23, 0x06,
-  0xca, 0x60, 0xce, 0x89, 0x3b, 0x87, 0xe3, 0xf1, 0x90, 0x31, 0x27, 0x79,
-  0x57, 0x4d, 0x0f, 0xba, 0xb5, 0x11, 0xd5, 0xb8, 0xe1, 0xf7, 0x45, 0x62,
-  0xc5, 0xf6, 0x99, 0x4f, 0xee, 0x00, 0x95, 0xbd, 0x57, 0xad, 0x0e, 0x27,
-  0xbe, 0x5e, 0x4f, 0x62, 0xcd, 0x53, 0x2f, 0xe5, 0xf5, 0x52, 0x1c, 0xb1,
-  0xc3, 0xc4, 0x28, 0x9d, 0x8b, 0xe4, 0x23, 0xdc, 0xb8, 0xaa, 0x3b, 0x7b,
-  0x2a, 0xd6, 0xd1, 0x04, 0x24, 0xf5, 0xf2, 0x7c, 0x77, 0xee, 0xa0, 0x10,
-  0x57, 0xab, 0xd5, 0x7b, 0x1f, 0x0c, 0xee, 0xd6, 0xa1, 0x6f, 0xf9, 0xf0,
-  0x90, 0xc8, 0x63, 0x33, 0x1e, 0x57, 0x5b, 0xc5, 0x24, 0xd5, 0xf0, 0x1b,
-  0x8c, 0x46, 0x23, 0xcc, 0x13, 0x6e, 0xb2, 0x19, 0xba, 0x35, 0x55, 0xed,
-  0x89, 0x6a, 0x51, 0x1c, 0xb2, 0xa2, 0x20, 0x24, 0x43, 0x26, 0xc1, 0x5c,
-  0x14, 0x59, 0x26, 0x12, 0xf2, 0xda, 0x28, 0x9b, 0x95, 0x29, 0xc9, 0x26,
-  0x9e, 0x24, 0x1d, 0x1e, 0xab, 0x25, 0x3b, 0xf6, 0x91, 0x83, 0x27, 0x5f,
-  0x42, 0x17, 0xd7, 0xdb, 0xed, 0xcb, 0x14, 0xd4, 0xd6, 0xf9, 0x26, 0x72,
-  0x79, 0x18, 0xa0, 0xb1, 0xcf, 0x8e, 0x78, 0xcf, 0x60, 0x12, 0xbd, 0x89,
-  0x08, 0x41, 0xab, 0x1e, 0x62, 0xa8, 0x3d, 0x98, 0x33, 0x44, 0xdd, 0x20,
-  0x9c, 0xa6, 0x2e, 0x13, 0xa3, 0x41, 0xdf, 0x6d, 0xa4, 0x1b, 0x04, 0xd6,
-  0x0a, 0x5b, 0x70, 0x2a, 0xc4, 0x2c, 0x21, 0x9e, 0x22, 0xc1, 0x73, 0xc5,
-  0x26, 0x16, 0x4a, 0x47, 0x07, 0x1d, 0x7e, 0x47, 0xb7, 0x9f, 0xe8, 0xd1,
-  0x9d, 0x27, 0x63, 0xd5, 0x61, 0x06, 0x66, 0x00, 0xab, 0x60, 0x88, 0x6f,
-  0x39, 0x48, 0x5a, 0x24, 0x02, 0x81, 0xb3, 0xb2, 0x14, 0x50, 0xb0, 0xa4,
-  0xc9, 0xd2, 0x88, 0x69, 0x56, 0xfc, 0x9b, 0xa9, 0x74, 0x38, 0x1c, 0x3e,
-  0x30, 0xe8, 0x6b, 0x95, 0x26, 0x1d, 0xa4, 0x9b, 0xd3, 0x58, 0x24, 0x16,
-  0xa2, 0x48, 0x70, 0xcb, 0x56, 0x5b, 0x93, 0xb2, 0x51, 0x5e, 0x9e, 0xe7,
-  0x9b, 0x94, 0x0b, 0xb0, 0x82, 0x2d, 0x5a, 0xa7, 0x93, 0xbb, 0x6e, 0x4f,
-  0xa3, 0xdb, 0xef, 0xf9, 0x9e, 0x86, 0x35, 0xb2, 0x43, 0x97, 0xef, 0x70,
-  0xeb, 0x76, 0xd1, 0x50, 0x28, 0x9c, 0x6f, 0x46, 0x1d, 0xb6, 0xae, 0x38,
-  0x0e, 0x2c, 0x95, 0x4b, 0x1c, 0x33, 0x29, 0x83, 0x91, 0x23, 0xb2, 0x93,
-  0x9b, 0xf1, 0x25, 0xb9, 0x15, 0x4f, 0x19, 0xe6, 0xb6, 0xc1, 0x03, 0x1a,
-  0xfc, 0x80, 0xd5, 0xf4, 0x7a, 0xf9, 0xa9, 0xb9, 0x25, 0x32, 0x66, 0x21,
-  0x48, 0xf3, 0x54, 0xb3, 0x52, 0xd3, 0xe9, 0xa0, 0x09, 0xb9, 0x48, 0x77,
-  0x43, 0x07, 0x5d, 0xa8, 0x4b, 0x39, 0x6c, 0x11, 0x9e, 0xd4, 0x79, 0x82,
-  0x55, 0x9f, 0x44, 0x3d, 0x3e, 0x89, 0x63, 0x53, 0x74, 0xe5, 0x38, 0xc5,
-  0x0f, 0xee, 0x2f, 0x08, 0xbb, 0x78, 0x3e, 0xb7, 0x5b, 0x48, 0x45, 0x41,
-  0xa7, 0xd8, 0x52, 0xb6, 0x18, 0xd4, 0x44, 0x1b, 0xb6, 0x20, 0x18, 0x83,
-  0x60, 0x28, 0xe8, 0xb5, 0x92, 0x3a, 0xf5, 0x57, 0x83, 0x21, 0xad, 0x52,
-  0xa9, 0xb4, 0x29, 0xbf, 0x83, 0xb4, 0x56, 0xb0, 0x05, 0xd2, 0xa1, 0xdb,
-  0x5b, 0xa5, 0x2d, 0x82, 0xcc, 0x3a, 0xf0, 0xac, 0xd9, 0xe1, 0x81, 0x4e,
-  0xd4, 0x20, 0x49, 0x6a, 0x6a, 0x73, 0xd0, 0x53, 0xd2, 0xad, 0x6b, 0xf0,
-  0xf5, 0x3e, 0x47, 0x3e, 0xba, 0xe4, 0x59, 0xc3, 0xef, 0x82, 0x46, 0xb5,
-  0xa8, 0x9d, 0x63, 0x9b, 0x74, 0x9b, 0x2d, 0xa4, 0x0f, 0x0e, 0x76, 0xe3,
-  0x7e, 0x37, 0x1f, 0xb2, 0xe9, 0x37, 0xa1, 0x11, 0x15, 0x52, 0x9b, 0x51,
-  0x18, 0x20, 0xbc, 0x41, 0xe8, 0x3b, 0x9b, 0x86, 0xaf, 0xa9, 0x3d, 0x18,
-  0xd7, 0xf6, 0xc3, 0x80, 0x05, 0x79, 0xd3, 0x39, 0xa0, 0xa4, 0x5c, 0x15,
-  0x1b, 0x65, 0x75, 0x7b, 0xb6, 0xfc, 0xca, 0x71, 0xa0, 0xc6, 0xd3, 0xc0,
-  0x0e, 0xd9, 0x80, 0xae, 0x49, 0xdb, 0x2a, 0xc1, 0x0a, 0x74, 0x08, 0x1d,
-  0x25, 0x0e, 0xcd, 0xcd, 0x47, 0x0b, 0x44, 0xb4, 0xe9, 0xec, 0x3b, 0x5d,
-  0x2b, 0xe1, 0x8f, 0xe1, 0xb7, 0x06, 0x49, 0xfc, 0x70, 0x00, 0xe6, 0x73,
-  0xce, 0x18, 0x57, 0xc7, 0xf7, 0x0a, 0xbb, 0xbb, 0x85, 0x3d, 0xc3, 0xa6,
-  0xda, 0x63, 0xa3, 0x42, 0xc9, 0x10, 0xa5, 0x31, 0x18, 0xf7, 0x76, 0x8d,
-  0xbb, 0xe1, 0xfd, 0x55, 0xc4, 0xd2, 0x39, 0x1a, 0x0e, 0x87, 0x7f, 0x43,
-  0xbd, 0xe1, 0x87, 0xe1, 0xb0, 0xe1, 0xd7, 0xc7, 0x41, 0x36, 0x36, 0xd0,
-  0xf1, 0xe8, 0xf5, 0x5b, 0xd0, 0x37, 0x41, 0xd7, 0x4c, 0x74, 0x6b, 0x18,
-  0x9b, 0x36, 0x29, 0xb7, 0x4b, 0xac, 0x27, 0x2f, 0x1f, 0x8b, 0x75, 0xa6,
-  0x36, 0x67, 0x33, 0xec, 0x5d, 0x2d, 0xa5, 0x3d, 0x3e, 0x3e, 0xa6, 0x2f,
-  0xd3, 0x07, 0x61, 0xd5, 0xf6, 0xf6, 0x36, 0x0c, 0x80, 0xe9, 0x02, 0x44,
-  0x6a, 0x03, 0xb2, 0x45, 0x0b, 0xc9, 0xdb, 0x5b, 0xca, 0x6f, 0x9c, 0xc3,
-  0xa5, 0x55, 0xbd, 0x5e, 0x58, 0x0c, 0x6f, 0xfa, 0x1d, 0x0d, 0x8f, 0xc7,
-  0xb3, 0xb5, 0xa1, 0xde, 0x84, 0x5d, 0x1b, 0x8d, 0x46, 0xe1, 0x83, 0xd4,
-  0xa6, 0x1a, 0x3e, 0xd4, 0x6f, 0xa8, 0x11, 0x55, 0xe7, 0xb6, 0x99, 0xe4,
-  0x0e, 0x51, 0x65, 0x92, 0x74, 0xc5, 0xc5, 0xd4, 0x43, 0xdc, 0x63, 0xb1,
-  0xd6, 0x37, 0x98, 0x1d, 0x11, 0x7c, 0xee, 0x97, 0x6f, 0x1f, 0x8f, 0x55,
-  0xa7, 0x7c, 0x1a, 0x1e, 0x71, 0xb4, 0x51, 0x85, 0xc3, 0xda, 0x03, 0x63,
-  0x7c, 0xcb, 0x6d, 0x85, 0xba, 0xa6, 0x69, 0x72, 0x63, 0x17, 0x1c, 0x3c,
-  0xcc, 0xcf, 0xe1, 0x95, 0x05, 0xc0, 0x8a, 0x6b, 0x20, 0x85, 0x90, 0x2e,
-  0x7f, 0x14, 0x70, 0x0c, 0xb8, 0x36, 0x41, 0xcf, 0xe0, 0x61, 0x33, 0x1e,
-  0x8f, 0x6f, 0xaa, 0xa3, 0x1e, 0x98, 0xae, 0x79, 0x0b, 0x41, 0x4c, 0xd8,
-  0x5c, 0x8c, 0x27, 0x63, 0x39, 0x6f, 0xe7, 0xb1, 0x58, 0xed, 0x4d, 0x39,
-  0xc3, 0x84, 0x1c, 0x1a, 0x2b, 0x75, 0x32, 0x97, 0xfe, 0xf6, 0x65, 0x6e,
-  0x86, 0xb5, 0xf2, 0x66, 0x45, 0x75, 0xac, 0x4d, 0xe3, 0x05, 0x8a, 0x46,
-  0x43, 0xb3, 0x15, 0x85, 0x92, 0xc2, 0xeb, 0x9a, 0xda, 0xb9, 0xf0, 0xfe,
-  0xc2, 0xcb, 0xd7, 0xe1, 0xb8, 0x07, 0xa6, 0x67, 0x97, 0xbb, 0xe6, 0xf0,
-  0x47, 0x37, 0x0d, 0x86, 0x54, 0x2a, 0x05, 0x6f, 0x5f, 0xf7, 0x8c, 0x88,
-  0xb7, 0xb9, 0x69, 0x88, 0x47, 0xa1, 0xe4, 0xac, 0x54, 0x2d, 0x32, 0x96,
-  0xb8, 0x1d, 0x39, 0x69, 0x4b, 0x9a, 0xef, 0x1e, 0xdd, 0xaa, 0x47, 0x06,
-  0x86, 0x93, 0xf9, 0xa8, 0xda, 0x71, 0x45, 0x6e, 0x9e, 0xab, 0x6b, 0x1f,
-  0xd2, 0x80, 0x85, 0x97, 0x31, 0xdf, 0xbc, 0x51, 0x6d, 0x87, 0x21, 0x6b,
-  0xf0, 0xbb, 0xbe, 0x16, 0x30, 0xb3, 0x88, 0x05, 0x7f, 0xf6, 0xe7, 0x7f,
-  0x5a, 0xd8, 0x4e, 0x81, 0x3d, 0x05, 0x6d, 0x72, 0xb9, 0x3c, 0x90, 0x34,
-  0xf0, 0xf6, 0xc0, 0xb4, 0x67, 0x44, 0xf9, 0x37, 0x80, 0xd5, 0x8f, 0x6f,
-  0xe8, 0x21, 0x5a, 0x36, 0xaa, 0xe1, 0x9a, 0x94, 0x9c, 0xd9, 0x1d, 0xb3,
-  0x37, 0x94, 0x1c, 0x3f, 0x7e, 0xaa, 0xd6, 0x67, 0xb8, 0x22, 0x75, 0x72,
-  0xa2, 0xa9, 0xf0, 0x8d, 0x13, 0x7d, 0x43, 0xc1, 0x5a, 0x55, 0x96, 0x72,
-  0xe9, 0xe4, 0x00, 0x56, 0x18, 0x90, 0x8e, 0x15, 0x2c, 0xad, 0x56, 0xb5,
-  0x38, 0xff, 0xd3, 0xab, 0x95, 0xdd, 0x2d, 0x9d, 0x1b, 0x2f, 0x04, 0xdb,
-  0xdc, 0x1a, 0xa8, 0xaf, 0xd4, 0xd7, 0x73, 0xbc, 0x78, 0x6d, 0x84, 0x77,
-  0x98, 0x45, 0x28, 0xb0, 0x86, 0x9b, 0xb4, 0xd1, 0x0d, 0x7f, 0xd1, 0x77,
-  0xb8, 0x9c, 0x2d, 0xf2, 0x74, 0xf0, 0xe8, 0xd1, 0x58, 0x9c, 0x8e, 0xe3,
-  0x8a, 0x95, 0x3d, 0x43, 0x34, 0xaa, 0xa9, 0x69, 0xf4, 0x27, 0x85, 0xb9,
-  0x30, 0x44, 0x6b, 0x75, 0x71, 0x86, 0x85, 0x87, 0x57, 0xdb, 0x60, 0xed,
-  0x95, 0x4b, 0xd3, 0x4a, 0xb0, 0x56, 0x16, 0xe7, 0x5f, 0xbe, 0xdc, 0x4f,
-  0x47, 0xdd, 0xca, 0xd5, 0x56, 0xaf, 0x55, 0xe7, 0xdf, 0xd8, 0x4c, 0x7d,
-  0x85, 0x40, 0xed, 0x19, 0x31, 0x68, 0x46, 0x43, 0x1c, 0x82, 0xe5, 0x77,
-  0x80, 0xd5, 0x0f, 0x36, 0xfc, 0x26, 0xee, 0xf0, 0x30, 0x63, 0xa6, 0x83,
-  0xcc, 0xe3, 0x6d, 0x20, 0x5b, 0xe1, 0x38, 0xf3, 0xa9, 0x2a, 0xfd, 0x69,
-  0x33, 0x15, 0x25, 0x6b, 0x27, 0xc6, 0x82, 0xf6, 0x21, 0x8b, 0xca, 0xa5,
-  0xe9, 0x87, 0xa5, 0xa4, 0x10, 0xa0, 0xc2, 0xc7, 0xfb, 0x0a, 0x96, 0x56,
-  0x8d, 0xc1, 0x02, 0x7f, 0xec, 0x75, 0x69, 0x40, 0xde, 0xbe, 0x22, 0x95,
-  0x11, 0x4a, 0x2c, 0xf5, 0x35, 0x05, 0x4a, 0x01, 0x15, 0xef, 0x76, 0x37,
-  0x05, 0x87, 0x5f, 0x18, 0x3a, 0x0f, 0x77, 0x2c, 0xb4, 0x57, 0x7a, 0x3c,
-  0x56, 0xc7, 0x2f, 0xd7, 0xbb, 0x9f, 0xde, 0xa4, 0x3f, 0x9d, 0x18, 0xd4,
-  0x95, 0x26, 0x60, 0x7d, 0x0c, 0x03, 0x97, 0x6a, 0x05, 0x2f, 0x92, 0x03,
-  0xd0, 0x22, 0xac, 0x7d, 0x90, 0x8c, 0x63, 0xcc, 0x20, 0x7c, 0x07, 0xb1,
-  0x5e, 0xad, 0x02, 0x16, 0xf8, 0x53, 0x1e, 0xdc, 0xbd, 0xd5, 0xe1, 0x57,
-  0xc7, 0xd1, 0x55, 0x00, 0xd9, 0x57, 0x28, 0xfd, 0x38, 0x14, 0xbc, 0xbe,
-  0x51, 0x23, 0x49, 0xda, 0xa2, 0xe3, 0xd9, 0xac, 0xcf, 0x97, 0x33, 0x05,
-  0xa9, 0xb3, 0x27, 0x98, 0xe6, 0x26, 0xc5, 0x04, 0x53, 0x2a, 0xe3, 0x49,
-  0xad, 0x62, 0xa9, 0x0a, 0xe7, 0x46, 0xe3, 0x6e, 0x5a, 0xb9, 0xa7, 0x60,
-  0xe5, 0x0d, 0x00, 0xbd, 0x59, 0x7d, 0xfb, 0xf6, 0xed, 0x6b, 0xe0, 0x53,
-  0xb0, 0xd2, 0x90, 0xdf, 0xc5, 0xc5, 0x57, 0xf3, 0x0b, 0x8b, 0x30, 0x44,
-  0xba, 0x2a, 0xde, 0x60, 0x08, 0x46, 0x2f, 0x97, 0x67, 0x23, 0xbe, 0xf9,
-  0x75, 0xc6, 0x75, 0x9e, 0x02, 0x79, 0x40, 0xad, 0x83, 0xfd, 0x40, 0xdf,
-  0xd2, 0x30, 0xfb, 0x8f, 0x27, 0x16, 0x9e, 0x96, 0x9f, 0x32, 0x62, 0xdc,
-  0xf8, 0x23, 0x57, 0xe7, 0x61, 0xb5, 0x83, 0x37, 0x57, 0xc7, 0xb4, 0x6a,
-  0x2f, 0xb5, 0x07, 0xfb, 0xee, 0x58, 0x51, 0x09, 0x48, 0x24, 0x50, 0xbd,
-  0x5d, 0x5d, 0x5c, 0x5c, 0xc1, 0xa3, 0xc8, 0x83, 0xdd, 0xf0, 0xca, 0x0a,
-  0x44, 0x6b, 0x7e, 0x61, 0xff, 0x40, 0xdd, 0x80, 0xe9, 0x35, 0x78, 0x9b,
-  0xc4, 0x70, 0x6d, 0x6d, 0xc4, 0xcf, 0x95, 0x60, 0xed, 0x9d, 0x1b, 0x50,
-  0x5d, 0xf1, 0x0e, 0x04, 0xf0, 0xd4, 0x5d, 0x73, 0x4f, 0x8c, 0xc8, 0x49,
-  0xca, 0x5b, 0xb1, 0x3f, 0x69, 0xf2, 0x21, 0xa7, 0xa6, 0x94, 0xd6, 0x6f,
-  0xb3, 0xb4, 0x86, 0xce, 0x93, 0xb5, 0x3d, 0xd0, 0xc5, 0x34, 0x14, 0xd1,
-  0x3f, 0xb0, 0x56, 0x17, 0x15, 0x6d, 0x9d, 0x33, 0x1a, 0xd3, 0xaa, 0x07,
-  0xac, 0xc5, 0x83, 0x78, 0xa3, 0x02, 0x06, 0x42, 0x88, 0x41, 0x53, 0x72,
-  0x83, 0x76, 0x9d, 0x7f, 0x3d, 0x57, 0xb4, 0xcb, 0x60, 0xc0, 0x7d, 0x88,
-  0x67, 0xbb, 0x60, 0xf5, 0xeb, 0x3d, 0x73, 0xc5, 0xa1, 0xf3, 0x26, 0x85,
-  0xa7, 0xcd, 0x89, 0x13, 0x1d, 0x9f, 0xfa, 0xe0, 0xba, 0x8a, 0xb4, 0xd8,
-  0xaa, 0xfe, 0x2d, 0x60, 0x9d, 0x17, 0xe6, 0xb0, 0x8a, 0x56, 0x56, 0x94,
-  0x58, 0xbd, 0x5d, 0x7d, 0x83, 0x3a, 0x31, 0xb7, 0xa7, 0x36, 0xa8, 0x70,
-  0x13, 0x28, 0x58, 0xda, 0x78, 0xc3, 0x65, 0x75, 0xe9, 0xbc, 0x16, 0x4b,
-  0x12, 0x7a, 0xb8, 0x5e, 0x1d, 0x8f, 0x2b, 0x4a, 0x0f, 0x12, 0x8f, 0xfb,
-  0x10, 0x1a, 0x78, 0xad, 0x12, 0x4c, 0x32, 0x2d, 0x98, 0x9c, 0xac, 0xc1,
-  0x69, 0xf5, 0x89, 0xe3, 0x2b, 0xa5, 0x33, 0x9e, 0x57, 0x2c, 0x97, 0x72,
-  0x51, 0x3e, 0x59, 0x85, 0xdf, 0x9e, 0x3a, 0xff, 0xa0, 0x54, 0xf7, 0x1b,
-  0xe5, 0x66, 0x0c, 0xe5, 0x42, 0x05, 0x8e, 0x1d, 0x5b, 0xc6, 0x85, 0xb5,
-  0x7d, 0xc0, 0x5a, 0x80, 0xee, 0xa3, 0xdd, 0xd4, 0x38, 0x1c, 0x9a, 0x86,
-  0x8e, 0x8e, 0x09, 0xa1, 0xa6, 0x0e, 0x5a, 0x90, 0x1a, 0xc4, 0x3e, 0x8e,
-  0x9e, 0x76, 0x43, 0xbf, 0xa5, 0x69, 0xe0, 0x85, 0x03, 0x5a, 0xe0, 0xad,
-  0x30, 0xe7, 0x7a, 0x83, 0xcd, 0xa7, 0xde, 0x84, 0x67, 0xd7, 0x9f, 0x1b,
-  0xad, 0x42, 0xe4, 0xa2, 0x6b, 0xdb, 0x5b, 0xdc, 0x53, 0xc7, 0x53, 0x50,
-  0xf5, 0xe9, 0x03, 0x10, 0xce, 0xd5, 0xb7, 0x48, 0xb5, 0x12, 0x4e, 0x83,
-  0x93, 0x50, 0xeb, 0xb7, 0xe6, 0x5e, 0x2d, 0xac, 0xee, 0xe3, 0x79, 0xdc,
-  0xda, 0x8a, 0xf6, 0xab, 0x1e, 0xaf, 0x6c, 0x6a, 0x48, 0x8b, 0x65, 0xca,
-  0xbb, 0x3d, 0x7e, 0xd4, 0x7a, 0xc8, 0x1f, 0x0e, 0x1f, 0x5b, 0x28, 0x5a,
-  0xe0, 0x05, 0x69, 0x8b, 0x17, 0x3c, 0xa1, 0xae, 0x66, 0x63, 0x9f, 0x3c,
-  0xec, 0x5b, 0x8c, 0x1f, 0xfc, 0xcd, 0x6e, 0xb7, 0xe9, 0xdf, 0xfc, 0x58,
-  0x50, 0xab, 0x0d, 0x7b, 0xc6, 0xc2, 0xdc, 0x4c, 0x55, 0xdf, 0x2a, 0xf7,
-  0xd1, 0xcc, 0x19, 0x53, 0x71, 0xbf, 0xce, 0x9f, 0x5e, 0x58, 0x58, 0x5d,
-  0xc1, 0xea, 0xc2, 0x73, 0x53, 0xb5, 0x46, 0xa7, 0x89, 0xea, 0xdd, 0x42,
-  0xcc, 0x44, 0x53, 0xb5, 0x86, 0x1f, 0x2c, 0x84, 0x1a, 0x9d, 0x84, 0x5e,
-  0xaf, 0xf7, 0x37, 0xdc, 0x56, 0xd2, 0x56, 0xe1, 0x2d, 0x34, 0x18, 0x56,
-  0x9d, 0xab, 0x61, 0x7f, 0x32, 0x56, 0xe7, 0x43, 0x41, 0x5d, 0x0b, 0xdd,
-  0x36, 0x3d, 0xfe, 0x28, 0x38, 0x2d, 0x94, 0xc7, 0x5d, 0xe8, 0x38, 0x20,
-  0x12, 0xfb, 0x2b, 0x78, 0xf0, 0xbe, 0xbb, 0x17, 0xd7, 0xeb, 0xdc, 0xfe,
-  0xf4, 0xea, 0xda, 0x7e, 0x18, 0xed, 0x98, 0x36, 0xbd, 0x6b, 0xdc, 0x68,
-  0xb8, 0xc1, 0x04, 0xba, 0x04, 0x21, 0x48, 0x55, 0xac, 0xc0, 0xa5, 0x8f,
-  0xe2, 0xd2, 0x83, 0x15, 0xd4, 0x28, 0x17, 0x0d, 0x9a, 0xb4, 0x85, 0x76,
-  0xf1, 0x26, 0xe8, 0x4f, 0x47, 0x4f, 0x3f, 0x1a, 0xb1, 0x9d, 0xa7, 0xe7,
-  0x1a, 0x17, 0x96, 0x2f, 0xfe, 0xda, 0xb7, 0x4d, 0x35, 0xca, 0x23, 0x88,
-  0x57, 0x18, 0xd5, 0x0b, 0x8f, 0x49, 0x61, 0xe6, 0x88, 0x36, 0x60, 0x6c,
-  0x9d, 0xdb, 0xd6, 0xee, 0x82, 0x2d, 0xdc, 0x34, 0x40, 0x5b, 0x36, 0xe8,
-  0xdd, 0x21, 0xc6, 0x52, 0x69, 0x0a, 0x53, 0x98, 0x27, 0x2a, 0x2e, 0x9d,
-  0x66, 0x4b, 0x3f, 0x5b, 0x58, 0x59, 0x6e, 0x37, 0xd5, 0x6c, 0x86, 0x04,
-  0x1e, 0x6a, 0xcf, 0x44, 0x5f, 0xfe, 0x85, 0xdb, 0x61, 0x3b, 0x06, 0xc3,
-  0x1b, 0x55, 0xb4, 0x72, 0xae, 0xfa, 0xb6, 0x61, 0x80, 0x6c, 0x6c, 0x9e,
-  0x17, 0x0a, 0x10, 0x15, 0xec, 0x37, 0x1f, 0x3f, 0x82, 0x87, 0x00, 0x81,
-  0xf4, 0x6f, 0x80, 0x94, 0xeb, 0xbd, 0xe6, 0xa4, 0x0d, 0xdc, 0xfa, 0x56,
-  0x34, 0xda, 0x88, 0x75, 0xae, 0x7d, 0x16, 0x8b, 0xe0, 0x75, 0x43, 0x29,
-  0xb9, 0xdd, 0x0d, 0x3c, 0x49, 0x52, 0x2e, 0xee, 0x37, 0xf0, 0x36, 0x20,
-  0x1b, 0xd5, 0xec, 0x5a, 0xa0, 0x57, 0x3b, 0xbc, 0x7f, 0x09, 0xeb, 0xbe,
-  0xd5, 0xd0, 0x6b, 0xdf, 0xfe, 0xfa, 0xb7, 0x5f, 0x8e, 0x8d, 0x0a, 0xd6,
-  0xd7, 0x3d, 0xf0, 0xf4, 0x90, 0xac, 0x34, 0x0c, 0x1c, 0x50, 0x58, 0x51,
-  0x87, 0x26, 0xbe, 0x7b, 0x50, 0xf0, 0x58, 0x4a, 0xef, 0xdf, 0x8f, 0x8b,
-  0x21, 0x9a, 0xd4, 0xb9, 0x92, 0x78, 0xbb, 0x62, 0x5d, 0xa6, 0x5d, 0x0d,
-  0xe5, 0xe6, 0x07, 0xdd, 0xdf, 0x6f, 0x84, 0x68, 0x38, 0x6a, 0x68, 0xef,
-  0xf9, 0x6e, 0x4c, 0x20, 0x35, 0x30, 0x3d, 0xb2, 0x7f, 0xe9, 0x9e, 0x66,
-  0x98, 0x54, 0x4e, 0xc3, 0x0b, 0xbf, 0x2c, 0xbc, 0xf9, 0x0a, 0xad, 0x56,
-  0x6d, 0x30, 0xec, 0xe1, 0x6d, 0x76, 0x7b, 0xa9, 0x73, 0xc5, 0xcd, 0x6f,
-  0xf9, 0xd5, 0xbb, 0x07, 0xdb, 0xdb, 0x6a, 0xe1, 0x90, 0x08, 0xe4, 0x27,
-  0x39, 0xb3, 0x25, 0x62, 0x66, 0xb9, 0xea, 0x8d, 0x8f, 0x09, 0x82, 0x83,
-  0x80, 0xc4, 0x41, 0x84, 0xc0, 0xab, 0xc2, 0x90, 0xa1, 0xc1, 0x3b, 0x80,
-  0xb0, 0x5d, 0x7a, 0x69, 0x13, 0x23, 0x9a, 0x6c, 0x6e, 0x57, 0xcd, 0xf7,
-  0x97, 0xb0, 0x8e, 0x1a, 0xd3, 0xc8, 0x17, 0x10, 0xac, 0x05, 0x23, 0x60,
-  0x6d, 0x40, 0x79, 0x7d, 0x55, 0x2c, 0x9d, 0x01, 0xba, 0x1c, 0xf4, 0xde,
-  0x78, 0x41, 0xb9, 0x3e, 0x65, 0x60, 0x7c, 0x13, 0x46, 0xce, 0x89, 0x1c,
-  0xb7, 0xc3, 0x98, 0x2f, 0x73, 0x77, 0x21, 0x9b, 0xcb, 0xa1, 0x8f, 0x6e,
-  0x6c, 0x80, 0x7e, 0x3a, 0x00, 0x4b, 0x33, 0xbb, 0xff, 0xc7, 0x45, 0xda,
-  0xbc, 0x3c, 0x7d, 0x35, 0x8d, 0x15, 0x63, 0xdd, 0xff, 0x5e, 0x1e, 0xbe,
-  0xe7, 0x20, 0xc9, 0x78, 0x6a, 0x3c, 0x36, 0x7e, 0x5c, 0x2b, 0x00, 0x56,
-  0x34, 0xaa, 0x86, 0x96, 0x0b, 0x13, 0x83, 0x1a, 0x25, 0x72, 0x43, 0xaf,
-  0x3f, 0x3f, 0x00, 0x6f, 0xb8, 0xb6, 0xb0, 0xb2, 0xe1, 0xf5, 0xda, 0xe8,
-  0x98, 0x2c, 0x72, 0xac, 0x1c, 0xb1, 0x08, 0x26, 0xda, 0x46, 0x3a, 0x70,
-  0xa6, 0xd8, 0xd2, 0x38, 0x1a, 0xb0, 0x3c, 0x30, 0x8f, 0x21, 0x96, 0x15,
-  0x2d, 0x0f, 0x3f, 0x39, 0xab, 0xde, 0x45, 0x88, 0xbf, 0x7c, 0x1b, 0xbf,
-  0x43, 0xf5, 0xdb, 0x2f, 0x8b, 0x8b, 0x6f, 0xd3, 0xc0, 0xa1, 0x8e, 0xaa,
-  0x15, 0x1c, 0x7c, 0x87, 0x53, 0xd6, 0x26, 0xa8, 0xd8, 0xfe, 0x5b, 0x10,
-  0xf9, 0x6d, 0xa3, 0xde, 0xe3, 0x0a, 0x9a, 0x8b, 0x8c, 0x7c, 0x17, 0xeb,
-  0x9a, 0xa6, 0x30, 0xb5, 0x62, 0xb4, 0xa0, 0x0b, 0x22, 0x95, 0x06, 0x06,
-  0xd7, 0x86, 0x0e, 0x66, 0x58, 0x12, 0x66, 0x7e, 0xba, 0x42, 0xdc, 0x7f,
-  0xc7, 0xfa, 0x7f, 0x63, 0x75, 0x3e, 0xbe, 0x5d, 0x00, 0x59, 0xff, 0x88,
-  0x40, 0xf8, 0xab, 0xf4, 0xb3, 0xe1, 0x0a, 0x96, 0xda, 0x98, 0x3e, 0x5e,
-  0x59, 0x5c, 0x5b, 0x78, 0xbb, 0xba, 0x32, 0xa7, 0xd6, 0xb8, 0xe8, 0xd8,
-  0x9d, 0x25, 0x99, 0xec, 0x86, 0x4c, 0x60, 0x6b, 0x2a, 0x20, 0xf1, 0x38,
-  0xb6, 0x42, 0x94, 0x94, 0x93, 0x5d, 0xbc, 0xb9, 0x0c, 0xc2, 0x05, 0x58,
-  0xee, 0xce, 0xf3, 0x60, 0xdd, 0x9b, 0x56, 0x7e, 0xfb, 0xdb, 0x6f, 0xab,
-  0x73, 0x68, 0xc6, 0xa1, 0x87, 0x6c, 0xf9, 0xb7, 0x14, 0x8d, 0xdc, 0x50,
-  0x1b, 0xce, 0xb1, 0x13, 0xbd, 0x5d, 0x5b, 0x80, 0xae, 0x93, 0x8e, 0x47,
-  0x3d, 0xfc, 0xad, 0x10, 0xa2, 0x69, 0x7a, 0x9a, 0x34, 0xd1, 0x4d, 0x1c,
-  0xa8, 0x3d, 0x78, 0x0b, 0x9e, 0xa2, 0x11, 0xb8, 0x0f, 0x75, 0x78, 0xb4,
-  0x0a, 0x49, 0xb4, 0x1d, 0x3d, 0x13, 0x96, 0xef, 0x2d, 0x60, 0x1d, 0x1b,
-  0x36, 0xe2, 0xb3, 0xeb, 0x01, 0x1a, 0x05, 0x0b, 0x6a, 0xcc, 0xb8, 0x0b,
-  0x16, 0x7e, 0xf5, 0xf5, 0xeb, 0xd7, 0x60, 0x25, 0xd2, 0x7b, 0x6a, 0x0d,
-  0x49, 0x07, 0xf9, 0x8a, 0x9b, 0x6c, 0xf2, 0x78, 0xa4, 0x4c, 0xba, 0x95,
-  0x83, 0x07, 0xb7, 0x8b, 0xd4, 0x29, 0xf5, 0x05, 0x7c, 0x80, 0x65, 0xa3,
-  0xa7, 0xa1, 0xfb, 0x67, 0xc2, 0x3a, 0x9a, 0xfb, 0xed, 0x97, 0x95, 0x94,
-  0xdb, 0x8f, 0xe1, 0xc2, 0x68, 0x69, 0x80, 0x4a, 0x51, 0xd6, 0x5d, 0x18,
-  0x5a, 0x17, 0xf7, 0xf7, 0xf7, 0x15, 0x83, 0x53, 0xd8, 0x84, 0xf1, 0xc2,
-  0x81, 0x62, 0x50, 0xb3, 0x52, 0x4d, 0x9b, 0x0b, 0x90, 0xf0, 0x5a, 0x01,
-  0xf8, 0x1c, 0x37, 0x5e, 0x7f, 0x75, 0xe1, 0x00, 0x49, 0x7a, 0x83, 0x53,
-  0xf9, 0xb9, 0xb0, 0xee, 0x05, 0x95, 0xd6, 0xa8, 0xb3, 0x50, 0x71, 0x2c,
-  0x74, 0xd4, 0xec, 0xe8, 0x66, 0x1c, 0x3a, 0x4d, 0xc1, 0x58, 0xd8, 0x3d,
-  0x38, 0xc6, 0x3b, 0x73, 0x1f, 0x66, 0x32, 0xa3, 0x5f, 0xa7, 0x01, 0xb1,
-  0xd2, 0xe3, 0x35, 0x57, 0xa4, 0x80, 0x81, 0xb1, 0x52, 0xb1, 0x91, 0xf8,
-  0x31, 0x8c, 0x69, 0xf8, 0x0e, 0x93, 0x38, 0x7c, 0x36, 0xac, 0xa3, 0x2f,
-  0x8e, 0xa6, 0xb9, 0xe8, 0x06, 0x65, 0xc0, 0x11, 0x14, 0xbc, 0x30, 0x98,
-  0x28, 0xb4, 0xc3, 0xe7, 0xa9, 0x73, 0x40, 0xd3, 0x1e, 0x2b, 0xa3, 0x99,
-  0xea, 0x20, 0x0e, 0x91, 0xf4, 0xeb, 0x68, 0xca, 0xed, 0x40, 0x2d, 0x85,
-  0xb4, 0xe1, 0xe5, 0x56, 0x8a, 0x84, 0xd6, 0xe8, 0xfa, 0x02, 0x88, 0x10,
-  0x36, 0xbc, 0x1c, 0x24, 0x3d, 0x1b, 0xd6, 0xfd, 0xd9, 0x50, 0x94, 0x7b,
-  0xe6, 0xbd, 0x0d, 0x1c, 0x5f, 0x14, 0xf1, 0x8a, 0x1b, 0x60, 0xc4, 0xda,
-  0x04, 0xaf, 0x15, 0x35, 0xa4, 0x60, 0xc0, 0x80, 0xce, 0x5d, 0xd8, 0xf0,
-  0x0a, 0x02, 0x5d, 0x31, 0x31, 0xac, 0xd8, 0x8a, 0xc4, 0xa6, 0x94, 0x1b,
-  0xaa, 0xdd, 0x0a, 0x03, 0xa3, 0x17, 0x13, 0x4a, 0x5a, 0x2b, 0x38, 0x6a,
-  0xc3, 0x17, 0xa6, 0xb6, 0xc1, 0xf3, 0x61, 0xcd, 0xee, 0x34, 0x2b, 0x80,
-  0xc6, 0x6f, 0xa2, 0xa8, 0x22, 0x15, 0x38, 0xe1, 0xa8, 0xa3, 0x46, 0x3a,
-  0xa2, 0x86, 0x39, 0xe8, 0x43, 0x0d, 0x9a, 0xd9, 0xc9, 0x2e, 0x4f, 0x38,
-  0x71, 0x98, 0xcd, 0xec, 0x64, 0x9d, 0x93, 0x7e, 0xdf, 0xc9, 0x46, 0x04,
-  0x93, 0x45, 0x08, 0xc2, 0xa6, 0x04, 0x1c, 0xc0, 0xc2, 0x9d, 0x68, 0xe5,
-  0x93, 0xde, 0xfb, 0x67, 0xc6, 0xea, 0x7c, 0xd8, 0x54, 0xc4, 0x3d, 0xba,
-  0x01, 0x1e, 0x06, 0xb0, 0xd4, 0x0e, 0xbc, 0x30, 0x61, 0x75, 0xe8, 0x82,
-  0xe6, 0xaa, 0x54, 0x2a, 0xf9, 0x0e, 0x0f, 0x0f, 0x9d, 0xd9, 0x89, 0x53,
-  0xc2, 0xe7, 0x3f, 0x0d, 0xec, 0xf6, 0x01, 0xd1, 0xf3, 0x39, 0xc5, 0xd8,
-  0x15, 0x4f, 0x59, 0xf1, 0x5e, 0x16, 0xd2, 0x01, 0x8f, 0x94, 0x29, 0xc4,
-  0x3c, 0x37, 0xd6, 0xbd, 0xfa, 0x1b, 0xe4, 0x0f, 0x25, 0x15, 0x92, 0x99,
-  0x3a, 0x8f, 0x6b, 0xa8, 0xdb, 0x58, 0x8b, 0xab, 0x72, 0x37, 0x83, 0xd1,
-  0xfa, 0x68, 0xb4, 0x5e, 0x0e, 0xe4, 0x71, 0x95, 0x47, 0xa3, 0x72, 0x7e,
-  0xac, 0x3c, 0x9d, 0xc0, 0xde, 0xe9, 0xb7, 0x2c, 0x5d, 0xda, 0x06, 0x09,
-  0xb4, 0xd9, 0x6c, 0x56, 0xbc, 0x57, 0xea, 0xd6, 0xd6, 0x7e, 0x76, 0x2c,
-  0x52, 0x8d, 0x22, 0x0a, 0x58, 0xe8, 0xd0, 0x53, 0xea, 0x1a, 0x1d, 0x61,
-  0x6f, 0x12, 0xf8, 0xcc, 0xa2, 0x71, 0x3f, 0x23, 0xe6, 0x72, 0x3b, 0xcb,
-  0xbe, 0x44, 0x22, 0xe1, 0xe3, 0xc4, 0x9c, 0x59, 0x66, 0xb9, 0x7e, 0xef,
-  0xa6, 0xca, 0xca, 0x30, 0x98, 0xf1, 0xd4, 0x0c, 0xcb, 0x66, 0xb5, 0xf1,
-  0x41, 0x61, 0x7a, 0xff, 0xec, 0x58, 0xf2, 0x09, 0x36, 0x1e, 0xe5, 0x0d,
-  0xa4, 0x75, 0xcb, 0xcd, 0x5b, 0x62, 0xf0, 0x47, 0xb0, 0x98, 0x23, 0x5e,
-  0x4d, 0x3c, 0xad, 0xdd, 0x8b, 0xe2, 0xd4, 0xec, 0x76, 0x58, 0x43, 0xb1,
-  0xa2, 0x38, 0x1c, 0xe6, 0x8a, 0x82, 0x09, 0xd6, 0x94, 0xe7, 0x81, 0xaa,
-  0x82, 0xc1, 0xf2, 0x06, 0x93, 0xdf, 0x29, 0x0f, 0x8f, 0xc2, 0xba, 0xf9,
-  0xa6, 0x3f, 0x45, 0x47, 0x87, 0xd7, 0x2e, 0x37, 0x36, 0x3c, 0x3a, 0x8a,
-  0xa7, 0x80, 0x42, 0xa3, 0xa3, 0x82, 0x30, 0x4e, 0xf8, 0xd5, 0xa8, 0x68,
-  0x6e, 0xf0, 0x79, 0xb7, 0xb0, 0x19, 0xeb, 0x75, 0x26, 0x16, 0x0a, 0x06,
-  0x83, 0x34, 0x1d, 0xc4, 0xab, 0x75, 0xe0, 0xdc, 0x6d, 0x0e, 0x07, 0x1d,
-  0x8a, 0xf0, 0xa3, 0xe7, 0xc7, 0x3a, 0xd2, 0xf8, 0x1b, 0x0e, 0xb4, 0x28,
-  0x78, 0x3a, 0xaa, 0x77, 0xb8, 0x9b, 0x24, 0x4e, 0x82, 0x9b, 0x5b, 0x6e,
-  0x6b, 0xf0, 0xce, 0x1c, 0xb1, 0xe0, 0x95, 0xe9, 0xe4, 0x5d, 0x31, 0xc7,
-  0x71, 0xc3, 0x0c, 0xcb, 0xc4, 0xa6, 0xd0, 0x83, 0x90, 0x8b, 0xf7, 0x42,
-  0x7f, 0xe6, 0x29, 0xda, 0x6a, 0x0b, 0x59, 0x62, 0xf2, 0xfd, 0xf3, 0x63,
-  0xdd, 0x5f, 0x34, 0x74, 0xca, 0x6d, 0x3c, 0x0e, 0xb0, 0xc2, 0x1e, 0x9d,
-  0x8b, 0x22, 0x35, 0xd8, 0x1a, 0x37, 0xb6, 0x48, 0x5e, 0x30, 0xe7, 0x44,
-  0x56, 0xcc, 0x89, 0x22, 0x9b, 0xe1, 0x96, 0xb9, 0xba, 0xd8, 0xba, 0x4b,
-  0x06, 0x15, 0x1e, 0x2f, 0x0d, 0x4c, 0x34, 0x3e, 0x57, 0x84, 0x0e, 0x26,
-  0x73, 0xc1, 0xb3, 0x1f, 0x81, 0xd5, 0xd6, 0x7c, 0xa9, 0xb9, 0x6b, 0x35,
-  0x10, 0x4a, 0x97, 0x1b, 0xbc, 0x66, 0x85, 0xd4, 0xe8, 0xc1, 0x46, 0x6f,
-  0x44, 0x1b, 0xbc, 0x00, 0x45, 0x7e, 0x23, 0x49, 0xd2, 0xa1, 0xd3, 0xb9,
-  0x9c, 0x1d, 0xca, 0xb2, 0xf9, 0xd6, 0x14, 0x0c, 0xf2, 0x18, 0x2a, 0x8c,
-  0x18, 0x5e, 0x37, 0x0e, 0x05, 0x6f, 0xcd, 0x96, 0xfe, 0xfd, 0x8f, 0xc0,
-  0xba, 0xbf, 0xb2, 0x7d, 0x01, 0x20, 0x87, 0x4e, 0xb9, 0xd7, 0x0f, 0xb0,
-  0x60, 0xde, 0x52, 0xc7, 0xa3, 0x7e, 0x1d, 0x95, 0x8c, 0xe4, 0x38, 0x5f,
-  0x09, 0xc4, 0x4b, 0x92, 0x26, 0x43, 0xf6, 0xf2, 0xce, 0x62, 0x9a, 0x62,
-  0x5d, 0x05, 0xf1, 0x89, 0x3e, 0x26, 0x93, 0x90, 0x34, 0x85, 0xba, 0xa6,
-  0x48, 0xce, 0x74, 0xf4, 0x63, 0xb0, 0x7c, 0x64, 0xd3, 0x4a, 0xe2, 0xa4,
-  0x85, 0xc7, 0xa3, 0x36, 0xca, 0x46, 0xea, 0x3c, 0x7a, 0xbd, 0x06, 0x5c,
-  0xa7, 0x49, 0x90, 0xeb, 0x4e, 0x5f, 0xc9, 0xe7, 0x73, 0x56, 0x87, 0xad,
-  0xa2, 0x39, 0x76, 0x6b, 0x9a, 0x4e, 0xa7, 0x18, 0xa4, 0xa4, 0x70, 0x2b,
-  0xe0, 0x75, 0x7e, 0x93, 0x29, 0xc6, 0x30, 0x8f, 0x78, 0xb5, 0x8a, 0x47,
-  0x61, 0x1d, 0x35, 0xaf, 0x6c, 0x56, 0x12, 0x72, 0x68, 0xf3, 0x52, 0x00,
-  0x06, 0x63, 0xb3, 0x1b, 0x66, 0x2b, 0xd2, 0xda, 0x0c, 0x9a, 0xcc, 0x2c,
-  0x5b, 0xe7, 0xb8, 0x0c, 0x94, 0xd5, 0x34, 0x08, 0x76, 0x3e, 0xd9, 0xed,
-  0x9a, 0x4c, 0xc0, 0x95, 0xb4, 0x24, 0x6f, 0x81, 0xaa, 0x0b, 0xdc, 0xa2,
-  0xf9, 0x47, 0x61, 0xdd, 0x9f, 0xf1, 0x16, 0xba, 0x82, 0x07, 0x1c, 0x30,
-  0x52, 0xf0, 0x94, 0x0d, 0xfa, 0x0a, 0x98, 0x18, 0x6b, 0xc5, 0x4b, 0x4f,
-  0x6f, 0x63, 0x77, 0x97, 0x66, 0x73, 0x51, 0x2e, 0xde, 0x59, 0x84, 0x18,
-  0xa8, 0x19, 0xe4, 0x0d, 0x96, 0xe9, 0xd6, 0x64, 0x4a, 0x0a, 0xb0, 0x2c,
-  0x45, 0x50, 0x59, 0xf6, 0x47, 0x61, 0xdd, 0x0f, 0x2d, 0x91, 0x20, 0xea,
-  0xb6, 0x17, 0xb6, 0x99, 0x97, 0x02, 0x91, 0x84, 0x0c, 0x36, 0x61, 0x72,
-  0x98, 0x62, 0x81, 0x63, 0x35, 0x4d, 0x4d, 0xdd, 0x2e, 0x0c, 0xd5, 0x50,
-  0x5b, 0x41, 0xac, 0x2d, 0x08, 0x14, 0xa8, 0x6a, 0xd2, 0x52, 0x64, 0x45,
-  0x26, 0xd6, 0xfa, 0x61, 0x58, 0xf7, 0xbf, 0x33, 0xcc, 0x2d, 0x98, 0x28,
-  0x18, 0xad, 0x9a, 0xd0, 0x54, 0x94, 0x42, 0x73, 0x51, 0xde, 0x26, 0x18,
-  0x99, 0x46, 0x03, 0x9d, 0x1f, 0xd8, 0xab, 0x26, 0x8e, 0x5d, 0x40, 0x8d,
-  0xef, 0x82, 0xc9, 0x2e, 0x80, 0xc5, 0x98, 0xcc, 0x0e, 0x23, 0x9b, 0xa9,
-  0xa3, 0x1f, 0x86, 0x75, 0xf4, 0x3b, 0xd7, 0xc2, 0x11, 0xa2, 0x09, 0x53,
-  0x04, 0xfa, 0x75, 0x0d, 0x2a, 0x18, 0x68, 0x3d, 0x4c, 0x1e, 0x30, 0x3b,
-  0x6b, 0x1c, 0xb0, 0x51, 0x6b, 0x60, 0xf7, 0x28, 0x08, 0x27, 0xc5, 0xe3,
-  0xf3, 0xb4, 0x4c, 0xdd, 0x8b, 0x58, 0x91, 0x83, 0x5e, 0x64, 0x36, 0xef,
-  0x88, 0x3f, 0x0c, 0xeb, 0xde, 0x59, 0x67, 0x19, 0xbc, 0x89, 0x87, 0xb2,
-  0x56, 0xf0, 0x2c, 0x04, 0x67, 0x0e, 0x30, 0xf0, 0x51, 0xf5, 0x06, 0x60,
-  0x61, 0x6b, 0xc2, 0x83, 0x19, 0xb2, 0x02, 0xb5, 0x47, 0xe1, 0xa2, 0x21,
-  0x81, 0x66, 0x86, 0x5b, 0xde, 0x61, 0x8a, 0xc5, 0x98, 0x93, 0xed, 0xfd,
-  0x30, 0xac, 0x3a, 0xe7, 0xb7, 0xe4, 0x2c, 0x53, 0x28, 0x2c, 0xd2, 0xa1,
-  0x01, 0x2f, 0x11, 0x85, 0x61, 0x76, 0x03, 0x0c, 0xab, 0xe2, 0xf2, 0xfd,
-  0x30, 0x79, 0xe1, 0x61, 0x03, 0x85, 0xa5, 0xe7, 0x85, 0x4c, 0x87, 0xa0,
-  0xd8, 0x99, 0xa1, 0x33, 0x03, 0xc1, 0x92, 0xbb, 0x24, 0x91, 0x3c, 0xfa,
-  0x41, 0x58, 0xd5, 0xea, 0xdd, 0xda, 0x31, 0xc5, 0x9a, 0x43, 0x50, 0x4f,
-  0x2e, 0x9d, 0x07, 0x0f, 0xfb, 0x60, 0xa1, 0x3b, 0xdc, 0xf2, 0x2b, 0x81,
-  0xf3, 0x40, 0x1e, 0x5d, 0x78, 0xc5, 0x00, 0xb6, 0x04, 0x94, 0x96, 0xe9,
-  0x2e, 0xc7, 0x2e, 0x73, 0xa2, 0x7c, 0x77, 0x57, 0x34, 0xa5, 0x73, 0xf9,
-  0xd8, 0x8f, 0xc1, 0x3a, 0xb3, 0xf8, 0xbe, 0xbc, 0xfb, 0x25, 0x6d, 0x61,
-  0xe5, 0x10, 0xcd, 0xdb, 0xc8, 0x1a, 0x84, 0x6a, 0x13, 0x0f, 0x6c, 0x61,
-  0x52, 0xc3, 0x13, 0x5b, 0x47, 0x03, 0xef, 0xf7, 0x26, 0xc1, 0xc4, 0xf3,
-  0x48, 0xc5, 0x87, 0x6e, 0x63, 0x22, 0x97, 0xe5, 0x44, 0xa6, 0x68, 0xbe,
-  0x33, 0x27, 0xc3, 0xde, 0x11, 0x17, 0xb1, 0xff, 0x00, 0xac, 0x8e, 0x65,
-  0xd2, 0xff, 0xf6, 0x62, 0x4d, 0x75, 0x6a, 0x61, 0x19, 0x8b, 0x29, 0x48,
-  0xbb, 0xf0, 0x42, 0x58, 0x34, 0x3a, 0x3b, 0xdc, 0xc6, 0x43, 0x90, 0x86,
-  0x06, 0x9f, 0x98, 0x05, 0xa5, 0x0e, 0xea, 0x10, 0x0a, 0x4d, 0x93, 0x72,
-  0x66, 0x79, 0x92, 0x65, 0xb1, 0xde, 0xef, 0xee, 0x6e, 0x77, 0x37, 0x89,
-  0x7c, 0xef, 0xb2, 0xf5, 0xec, 0x58, 0x3d, 0x53, 0xc6, 0x39, 0xd4, 0xbe,
-  0x98, 0x57, 0x9d, 0x53, 0x97, 0xf5, 0xba, 0x6c, 0xee, 0x52, 0x3a, 0x8f,
-  0x7f, 0x6b, 0x56, 0x53, 0x3a, 0x77, 0xcd, 0x45, 0xba, 0x75, 0x78, 0x73,
-  0x81, 0x0d, 0x6f, 0x77, 0x03, 0x85, 0x4f, 0x46, 0x18, 0x2e, 0x5b, 0xcd,
-  0xd6, 0x21, 0x58, 0x91, 0x58, 0x2c, 0x92, 0xdc, 0xdd, 0x9e, 0xd8, 0x89,
-  0xf1, 0x30, 0x32, 0x7a, 0x5e, 0x2c, 0xee, 0x6e, 0xb9, 0xda, 0x6b, 0xbd,
-  0x7c, 0x37, 0xff, 0x66, 0x4e, 0xf3, 0x3b, 0xc3, 0xe2, 0x96, 0xf4, 0x56,
-  0xdc, 0x8d, 0x86, 0x03, 0x76, 0x1f, 0x89, 0x4d, 0x12, 0x6c, 0x21, 0xb8,
-  0xd0, 0x0a, 0x4c, 0xf4, 0xd0, 0x9f, 0x63, 0x91, 0x22, 0xdb, 0x9f, 0x54,
-  0xb9, 0x61, 0x5d, 0x94, 0xcd, 0x31, 0x8b, 0x25, 0x42, 0x6b, 0x7f, 0x36,
-  0x8f, 0x3a, 0xe3, 0xf1, 0xd8, 0x2c, 0x3d, 0x27, 0x56, 0xab, 0xc8, 0x65,
-  0x97, 0x4b, 0xe6, 0x77, 0xef, 0x7e, 0x7b, 0x93, 0xde, 0x68, 0x42, 0x3b,
-  0x61, 0xd9, 0x96, 0x65, 0xda, 0x24, 0x49, 0x14, 0x0b, 0x48, 0x1b, 0x2c,
-  0x18, 0x57, 0xe1, 0x23, 0x01, 0xba, 0xb3, 0x00, 0x50, 0x43, 0xa7, 0x04,
-  0x5d, 0x12, 0x06, 0xc7, 0x22, 0xb8, 0x44, 0xc0, 0x0a, 0x7f, 0xbe, 0x1d,
-  0x0d, 0xc6, 0x63, 0xa2, 0xc3, 0xb4, 0x06, 0xcf, 0x86, 0x15, 0x11, 0xfb,
-  0xcb, 0xd9, 0x43, 0x22, 0xf8, 0xe2, 0xdd, 0x6f, 0x8b, 0xda, 0xaf, 0x1a,
-  0x3a, 0x69, 0x6e, 0x01, 0x98, 0x28, 0x0b, 0x53, 0x53, 0x68, 0x6a, 0xba,
-  0xb5, 0x40, 0x27, 0xb4, 0x80, 0x53, 0x08, 0x0a, 0x77, 0x77, 0xd0, 0x1b,
-  0xe5, 0x16, 0x40, 0x4d, 0x86, 0x0a, 0x14, 0xd4, 0x7b, 0xc4, 0x12, 0x33,
-  0xdb, 0xf6, 0xdf, 0xf1, 0xf8, 0xf4, 0xbf, 0x3c, 0xd1, 0xe9, 0x51, 0xe4,
-  0xe4, 0xec, 0x39, 0xb0, 0xce, 0x58, 0xb3, 0x4f, 0x3a, 0xcc, 0x3a, 0x09,
-  0xdb, 0x8b, 0x77, 0x3f, 0xad, 0x85, 0x8d, 0x51, 0x5b, 0x28, 0x19, 0x91,
-  0x99, 0xfa, 0x04, 0xbc, 0x28, 0x9b, 0x63, 0xe4, 0x22, 0xf8, 0x96, 0x56,
-  0x0b, 0x44, 0x53, 0x66, 0x5a, 0x90, 0xde, 0x3a, 0x40, 0xf5, 0x27, 0x43,
-  0x51, 0xcc, 0x31, 0xcc, 0xa5, 0x39, 0x82, 0xc8, 0x45, 0xcd, 0xcf, 0x2f,
-  0xdc, 0x76, 0x7b, 0x47, 0x79, 0x5e, 0xdb, 0x58, 0x0c, 0xea, 0xe8, 0x0c,
-  0x71, 0xf6, 0xd7, 0xb0, 0xc6, 0x11, 0x53, 0x8b, 0x9b, 0x48, 0x59, 0x67,
-  0xa2, 0x43, 0x22, 0xd6, 0xf1, 0x87, 0xa8, 0x8e, 0x0f, 0x76, 0x85, 0x08,
-  0xc3, 0x0e, 0x27, 0x13, 0xc9, 0x59, 0xe5, 0xaa, 0x60, 0xff, 0x32, 0x50,
-  0x48, 0x1c, 0x07, 0xff, 0x9d, 0xd4, 0xf7, 0x25, 0x7a, 0x93, 0xe1, 0x50,
-  0x6c, 0x21, 0x30, 0xc4, 0x2a, 0x06, 0x5c, 0xf2, 0xde, 0xbb, 0x17, 0x7e,
-  0x7c, 0x01, 0x02, 0xbc, 0xbf, 0x2a, 0x90, 0xef, 0x2d, 0xb7, 0x2e, 0x4d,
-  0x14, 0xc5, 0x8e, 0x9e, 0x7a, 0xff, 0x16, 0xd1, 0x82, 0x09, 0x2b, 0xe3,
-  0xec, 0x4b, 0x30, 0x38, 0xfb, 0xf2, 0xae, 0x17, 0x2f, 0x7e, 0x5e, 0x53,
-  0xed, 0xaa, 0x35, 0x36, 0x1a, 0xef, 0x7f, 0x82, 0x80, 0x55, 0x9d, 0xb0,
-  0xfa, 0xce, 0xc9, 0x04, 0x1e, 0xa5, 0x9b, 0x1b, 0x5f, 0xaf, 0xe7, 0x83,
-  0x48, 0x71, 0x90, 0x3f, 0x11, 0x42, 0x28, 0x5f, 0x82, 0x36, 0x44, 0x62,
-  0x82, 0x39, 0xb9, 0xf2, 0xf9, 0xc5, 0x96, 0xf2, 0x7c, 0xff, 0x40, 0x3e,
-  0x10, 0x50, 0x5e, 0x2d, 0x62, 0x59, 0xb4, 0x98, 0xf8, 0xdf, 0xab, 0x83,
-  0xc7, 0x63, 0x5d, 0x57, 0xcd, 0xe6, 0xec, 0xb8, 0xc4, 0x71, 0xce, 0xbe,
-  0x0f, 0x27, 0x7a, 0x42, 0xf7, 0xe2, 0x1d, 0x60, 0x7d, 0x50, 0x9f, 0x92,
-  0x60, 0x10, 0xa6, 0xb7, 0x91, 0x48, 0x8e, 0x85, 0x88, 0x21, 0x54, 0xbf,
-  0x0f, 0xe4, 0x60, 0x51, 0x6f, 0x60, 0xff, 0xc1, 0xf6, 0x53, 0x12, 0x28,
-  0x17, 0x8b, 0x60, 0xc3, 0x70, 0x23, 0xb6, 0x4e, 0x3e, 0x7f, 0x7e, 0xe1,
-  0x6e, 0x2b, 0xcf, 0x4e, 0x0c, 0xd8, 0x81, 0x4a, 0x89, 0x5a, 0x4f, 0x9a,
-  0x88, 0x17, 0x5d, 0xda, 0x4c, 0x3c, 0x0a, 0x6b, 0x90, 0x61, 0xa5, 0x5e,
-  0x22, 0x01, 0x6e, 0x38, 0xe1, 0x93, 0xd0, 0xac, 0x27, 0x88, 0xda, 0x8b,
-  0x17, 0x9f, 0x17, 0x55, 0xe9, 0x4d, 0x3f, 0xec, 0x40, 0x2f, 0xd8, 0xd2,
-  0xe4, 0xa5, 0xdc, 0x62, 0x87, 0xd5, 0x6a, 0x75, 0x02, 0x64, 0x87, 0x87,
-  0x92, 0xe4, 0xcc, 0x0e, 0xa1, 0xce, 0xc5, 0x96, 0x52, 0x69, 0x45, 0xc4,
-  0xba, 0x03, 0x6b, 0xc8, 0x08, 0x2b, 0xbf, 0xfe, 0xfa, 0x8e, 0x1a, 0xcd,
-  0xb0, 0x66, 0x2f, 0x26, 0x91, 0xcf, 0x77, 0xf2, 0x44, 0xc2, 0xd7, 0x77,
-  0x72, 0x2d, 0xba, 0xc9, 0x76, 0x8e, 0xbe, 0x13, 0x8b, 0xc8, 0x65, 0xf1,
-  0x95, 0x61, 0x08, 0xa2, 0xe4, 0x2c, 0x8d, 0xc7, 0x4e, 0xdf, 0x38, 0xe1,
-  0x4b, 0x04, 0x2a, 0x2f, 0x5e, 0xbc, 0x58, 0x08, 0x7f, 0x34, 0x9c, 0x7e,
-  0x21, 0xf1, 0x3c, 0x32, 0x18, 0xbc, 0x0d, 0x09, 0x4a, 0x95, 0x73, 0xd5,
-  0x6a, 0x16, 0xa2, 0x96, 0xc5, 0x79, 0x8c, 0x91, 0x21, 0x4e, 0x97, 0x18,
-  0x27, 0x25, 0x5a, 0x31, 0x21, 0x32, 0xd1, 0xbf, 0xfb, 0xdb, 0xaf, 0xef,
-  0xe8, 0x51, 0xf9, 0xe1, 0x19, 0x6d, 0x33, 0x2e, 0x7c, 0x55, 0x0d, 0x7c,
-  0x46, 0x7b, 0x69, 0xb9, 0x75, 0x4b, 0x7d, 0xb9, 0xeb, 0x7c, 0x07, 0x56,
-  0xbb, 0xce, 0x26, 0x94, 0xd3, 0x0e, 0x82, 0x90, 0xa4, 0x52, 0xa2, 0x74,
-  0x98, 0x20, 0x00, 0x2d, 0x60, 0x03, 0xac, 0xcf, 0xe1, 0xdd, 0xd4, 0x86,
-  0xdf, 0x5d, 0xa9, 0xd8, 0x9a, 0x3c, 0xb8, 0xaa, 0x69, 0xa4, 0x28, 0xc3,
-  0x88, 0x58, 0xaf, 0xd7, 0x87, 0xd5, 0xe1, 0xce, 0x90, 0x6d, 0x29, 0xb9,
-  0xbb, 0x8b, 0x44, 0x22, 0x97, 0x77, 0xe6, 0x59, 0x0e, 0x39, 0xcb, 0xca,
-  0xaf, 0x7f, 0xfb, 0xf5, 0xd7, 0x29, 0x46, 0x0b, 0x4b, 0xeb, 0xe1, 0xa9,
-  0x6d, 0xf6, 0x80, 0xf2, 0x02, 0x50, 0x18, 0x33, 0x48, 0xe6, 0x55, 0xad,
-  0xc9, 0x75, 0xfe, 0x7b, 0xac, 0x23, 0x96, 0x4b, 0x24, 0xf0, 0xc5, 0x16,
-  0x80, 0xaa, 0xd4, 0x4f, 0x80, 0x36, 0x13, 0x25, 0x88, 0x9a, 0xd4, 0xa1,
-  0x00, 0xeb, 0xc5, 0xcf, 0xc6, 0xb8, 0x5a, 0xef, 0xc7, 0xe3, 0x34, 0x30,
-  0xa3, 0x7c, 0xd0, 0x04, 0x5a, 0x55, 0x04, 0x7d, 0x00, 0x34, 0x96, 0x05,
-  0xb9, 0x60, 0xa0, 0x35, 0x83, 0x2a, 0x80, 0x84, 0xde, 0x29, 0xa2, 0x25,
-  0xb0, 0x72, 0xf8, 0x1d, 0xac, 0xdf, 0x2c, 0xeb, 0xf6, 0x87, 0xe2, 0xfa,
-  0xe3, 0x25, 0x6f, 0x06, 0x01, 0xe5, 0x15, 0x3a, 0xe0, 0xd7, 0xf4, 0x38,
-  0x88, 0xf2, 0x55, 0xf3, 0x4a, 0x1c, 0xfc, 0x97, 0x58, 0x47, 0x3d, 0x79,
-  0x99, 0x48, 0x10, 0xca, 0x4f, 0x10, 0x63, 0x9f, 0x84, 0x2f, 0x51, 0x31,
-  0x2e, 0xc1, 0xdf, 0x44, 0x67, 0x8a, 0x58, 0x2f, 0x54, 0xfe, 0x86, 0x7e,
-  0xab, 0x01, 0x5e, 0xc1, 0x85, 0xd7, 0x26, 0x78, 0x93, 0xc5, 0x12, 0x03,
-  0x11, 0x65, 0x98, 0x1c, 0x28, 0x02, 0x16, 0xba, 0x0c, 0xc1, 0x8a, 0xe1,
-  0x17, 0x61, 0x3a, 0x8b, 0x81, 0x8b, 0x30, 0x20, 0xd5, 0xbb, 0x35, 0x79,
-  0xf4, 0x90, 0x3e, 0xc0, 0x52, 0x9e, 0xaf, 0x35, 0x2b, 0x31, 0x45, 0x35,
-  0xf2, 0x84, 0x04, 0x7d, 0xf6, 0x92, 0xb9, 0xb8, 0xfa, 0xbd, 0xdf, 0xfe,
-  0xb7, 0x58, 0xce, 0x62, 0x9f, 0xc0, 0x57, 0xed, 0xc1, 0x70, 0x63, 0x69,
-  0x95, 0xf2, 0xf8, 0xcc, 0x0a, 0x78, 0x74, 0x4a, 0xed, 0x88, 0x82, 0xf5,
-  0x22, 0xac, 0xf3, 0xeb, 0x35, 0x38, 0xfc, 0xe3, 0x8d, 0xb9, 0xd0, 0x70,
-  0xa6, 0xa1, 0x24, 0xf8, 0x50, 0xb3, 0xf9, 0x12, 0x88, 0x22, 0x91, 0x3b,
-  0x98, 0x80, 0x00, 0x0b, 0xfa, 0x33, 0xbe, 0x63, 0xeb, 0x86, 0x9f, 0x7f,
-  0x45, 0x2c, 0x15, 0xa7, 0x60, 0x29, 0x49, 0x2c, 0x2b, 0xcf, 0x8b, 0x52,
-  0xea, 0x3f, 0x80, 0xaf, 0xa7, 0x02, 0xe5, 0x3f, 0x1e, 0xf7, 0xb3, 0x99,
-  0x9d, 0x4c, 0x86, 0x15, 0x6f, 0xff, 0x0d, 0xd6, 0xc0, 0x52, 0x57, 0x9e,
-  0xe1, 0x31, 0xdb, 0x2f, 0xc4, 0xec, 0xd5, 0x3c, 0x30, 0x5c, 0xc4, 0x78,
-  0xb9, 0x64, 0xaf, 0xbf, 0x9c, 0x71, 0xcd, 0x39, 0x1a, 0x78, 0x95, 0xd0,
-  0x0f, 0x21, 0xc3, 0xeb, 0x71, 0x38, 0xf5, 0xe0, 0x50, 0x86, 0xb7, 0x62,
-  0x03, 0x16, 0x14, 0x16, 0x4c, 0x65, 0x02, 0xce, 0x66, 0x77, 0x2c, 0x1b,
-  0x7f, 0xf7, 0x2b, 0x62, 0xbd, 0x98, 0x93, 0x66, 0xaf, 0xe2, 0xa2, 0x94,
-  0x96, 0xf2, 0xa4, 0xbb, 0xc0, 0xc3, 0x27, 0xb8, 0x11, 0xf2, 0x4a, 0x4a,
-  0x0e, 0xb3, 0x20, 0x46, 0xcb, 0xff, 0x47, 0x80, 0x01, 0x00, 0x88, 0xf1,
-  0x85, 0x63, 0x2e, 0xa2, 0xc3, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
-  0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int station_logo_len = 10314;
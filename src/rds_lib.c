@@ -55,6 +55,14 @@ char *get_pty(uint8_t region, uint8_t pty) {
 	return ptys[region][pty];
 }
 
+enum offset_word_index {
+	OFFSET_A,
+	OFFSET_B,
+	OFFSET_C,
+	OFFSET_D,
+	OFFSET_CP // C'
+};
+
 static uint16_t offset_words[] = {
 	0x0FC, // A
 	0x198, // B
@@ -75,26 +83,98 @@ static uint16_t crc(uint16_t block) {
 		crc <<= 1;
 		if ((msb ^ bit) != 0) crc ^= POLY;
 	}
-	return crc;
+
+	return crc & ((1 << POLY_DEG) - 1);
 }
 
-// Calculate the checkword for each block and emit the bits
-void add_checkwords(uint16_t *blocks, uint8_t *bits) {
-	uint16_t block, check, offset_word;
-	for (int i = 0; i < GROUP_LENGTH; i++) {
-		block = blocks[i];
-		offset_word = offset_words[i];
-		if (((blocks[1] >> 11) & 1) && i == 3) offset_word = offset_words[5];
-		check = crc(block) ^ offset_word;
-		for (int j = 0; j < BLOCK_SIZE; j++) {
-			*bits++ = ((block & (1 << (BLOCK_SIZE - 1))) != 0);
-			block <<= 1;
+/* Block lookup tables
+ *
+ * The checkword is linear in the data bits so a full 26-bit block can be
+ * put together from one lookup per data byte. The offset words are folded
+ * into the upper byte tables.
+ */
+static uint32_t block_hi[5][256];
+static uint32_t block_lo[256];
+
+void init_checkword_tables() {
+	for (uint16_t i = 0; i < 256; i++) {
+		block_lo[i] = (uint32_t)i << POLY_DEG | crc(i);
+		for (uint8_t j = 0; j < 5; j++) {
+			block_hi[j][i] = (uint32_t)i << (POLY_DEG + 8) |
+				(crc(i << 8) ^ offset_words[j]);
 		}
-		for (int j = 0; j < POLY_DEG; j++) {
-			*bits++ = ((check & (1 << (POLY_DEG - 1))) != 0);
-			check <<= 1;
+	}
+}
+
+static inline uint32_t encode_block(uint16_t block, uint8_t offset) {
+	return block_hi[offset][block >> 8] ^ block_lo[block & 0xff];
+}
+
+/* Calculate the checkword for each block and pack the group
+ * MSB first into two 64-bit words
+ */
+void add_checkwords(uint16_t *blocks, uint64_t *bits) {
+	uint64_t a, b, c, d;
+
+	a = encode_block(blocks[0], OFFSET_A);
+	b = encode_block(blocks[1], OFFSET_B);
+	// version B groups use C' for the third block
+	c = encode_block(blocks[2], (blocks[1] >> 11) & 1 ? OFFSET_CP : OFFSET_C);
+	d = encode_block(blocks[3], OFFSET_D);
+
+	bits[0] = a << 38 | b << 12 | c >> 14;
+	bits[1] = (c & 0x3fff) << 50 | d << 24;
+}
+
+/* CRC-CCITT (x^16 + x^12 + x^5 + 1), preset to FFFF
+ */
+uint16_t crc16_ccitt(uint8_t *data, uint16_t len) {
+	uint16_t crc = 0xffff;
+
+	for (uint16_t i = 0; i < len; i++) {
+		crc ^= data[i] << 8;
+		for (uint8_t j = 0; j < 8; j++) {
+			crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
 		}
 	}
+
+	return crc;
+}
+
+/* Unpack the information words of a packed group, dropping the checkwords
+ */
+void get_group_blocks(uint64_t *bits, uint16_t *blocks) {
+	uint32_t c = (bits[0] & 0xfff) << 14 | bits[1] >> 50;
+
+	blocks[0] = bits[0] >> 48;
+	blocks[1] = bits[0] >> 22;
+	blocks[2] = c >> POLY_DEG;
+	blocks[3] = bits[1] >> 34;
+}
+
+/* Re-encode a single block of a packed group
+ */
+void update_checkword(uint64_t *bits, uint8_t num, uint16_t block) {
+	uint8_t offset = num;
+	uint8_t pos = num * (BLOCK_SIZE + POLY_DEG);
+	uint8_t word = pos >> 6;
+	int8_t shift = 64 - (BLOCK_SIZE + POLY_DEG) - (pos & 63);
+	uint64_t mask = (1ULL << (BLOCK_SIZE + POLY_DEG)) - 1;
+	uint64_t encoded;
+
+	// version B groups use C' for the third block
+	if (num == 2 && ((bits[0] >> (12 + POLY_DEG + 11)) & 1)) offset = OFFSET_CP;
+
+	encoded = encode_block(block, offset);
+
+	if (shift >= 0) {
+		bits[word] = (bits[word] & ~(mask << shift)) | encoded << shift;
+	} else {
+		// block straddles both words
+		bits[word] = (bits[word] & ~(mask >> -shift)) | encoded >> -shift;
+		bits[word+1] = (bits[word+1] & ~(mask << (64 + shift))) |
+			encoded << (64 + shift);
+	}
 }
 
 /*
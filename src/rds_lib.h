@@ -17,7 +17,11 @@
  */
 
 extern char *get_pty(uint8_t region, uint8_t pty);
-extern void add_checkwords(uint16_t *blocks, uint8_t *bits);
+extern void init_checkword_tables();
+extern void add_checkwords(uint16_t *blocks, uint64_t *bits);
+extern void update_checkword(uint64_t *bits, uint8_t num, uint16_t block);
+extern void get_group_blocks(uint64_t *bits, uint16_t *blocks);
+extern uint16_t crc16_ccitt(uint8_t *data, uint16_t len);
 extern uint16_t callsign2pi(char *callsign);
 
 // TMC
@@ -17,81 +17,258 @@
  */
 
 #include "common.h"
+#include "rds.h"
 #ifdef RDS2
 #include "rds2.h"
 #endif
 #include "fm_mpx.h"
 #include "waveforms.h"
 #include "rds_modulator.h"
+#include "arena.h"
 
-static float *sym_waveforms[2];
-
-/*
- * Also create the inverted version of the symbol waveform
+/* Pre-rendered bit periods
+ *
+ * A symbol waveform spans SYMBOL_SPAN bit periods so the output during
+ * one bit only depends on the last SYMBOL_SPAN differential symbols.
+ * Every combination is rendered once here, which turns the modulator
+ * into a table lookup. The table is shared by all modulators.
  */
-void init_symbol_waveforms() {
-	for (uint8_t i = 0; i < 2; i++) {
-		sym_waveforms[i] = malloc(FILTER_SIZE * sizeof(float));
-		for (uint16_t j = 0; j < FILTER_SIZE; j++) {
-			sym_waveforms[i][j] = (i) ?
-				+waveform_biphase[j] : -waveform_biphase[j];
+static float *bit_waveforms[NUM_SYMBOL_WINDOWS];
+
+void init_symbol_waveforms(struct arena_t *arena) {
+	float sample;
+
+	for (uint8_t i = 0; i < NUM_SYMBOL_WINDOWS; i++) {
+		bit_waveforms[i] = alloc_from_arena(arena,
+			SAMPLES_PER_BIT * sizeof(float));
+		for (uint8_t j = 0; j < SAMPLES_PER_BIT; j++) {
+			sample = 0.0f;
+			// oldest symbol first
+			for (int8_t k = SYMBOL_SPAN - 1; k >= 0; k--) {
+				sample += ((i >> k) & 1) ?
+					+waveform_biphase[k * SAMPLES_PER_BIT + j] :
+					-waveform_biphase[k * SAMPLES_PER_BIT + j];
+			}
+			bit_waveforms[i][j] = sample;
 		}
 	}
 }
 
-void exit_symbol_waveforms() {
-	for (uint8_t i = 0; i < 2; i++) {
-		free(sym_waveforms[i]);
+/* Set up a modulator for an encoder. RDS2 streams are only modulated if
+ * num_streams covers them, there is one RDS2 encoder per process.
+ */
+void init_rds_modulator(struct rds_modulator_t *mod,
+	struct rds_encoder_t *enc, uint8_t num_streams) {
+	memset(mod, 0, sizeof(struct rds_modulator_t));
+	mod->enc = enc;
+	mod->num_streams = num_streams;
+
+	// start on a bit boundary
+	for (uint8_t i = 0; i < NUM_RDS_STREAMS; i++) {
+		mod->contexts[i].sample_count = SAMPLES_PER_BIT;
+	}
+}
+
+static void get_group_bits(struct rds_modulator_t *mod, uint8_t stream_num,
+	uint64_t *bits) {
+#ifdef RDS2
+	if (stream_num > 0) {
+		get_rds2_bits(stream_num, bits);
+	} else {
+		get_rds_bits(mod->enc, bits);
+	}
+#else
+	(void)stream_num;
+	get_rds_bits(mod->enc, bits);
+#endif
+}
+
+/* Take back the queued groups of the basic stream that can still be
+ * changed and rewind the encoder, so whatever changed since they were
+ * built, e.g. a command scheduled for one of them, goes out with them.
+ */
+static void take_back_groups(struct rds_modulator_t *mod) {
+	uint32_t count = mod->enc->unchanged_groups;
+	int16_t taken;
+
+	if (count > GROUP_FIFO_SIZE) count = GROUP_FIFO_SIZE;
+	if (count > RDS_CHECKPOINTS) count = RDS_CHECKPOINTS;
+	if (!count) return;
+
+	taken = group_fifo_unpush(&mod->group_fifos[0], count);
+	if (taken > 0) rewind_rds_encoder(mod->enc, taken);
+}
+
+/* Top up the group FIFO of a stream. Each stream has its own encoder
+ * state, so different streams may be filled from different threads, but
+ * only one thread may fill a given stream.
+ */
+void fill_rds_group_fifo(struct rds_modulator_t *mod, uint8_t stream_num) {
+	struct group_fifo_t *fifo = &mod->group_fifos[stream_num];
+	uint64_t bits[GROUP_WORDS];
+
+	if (stream_num == 0 &&
+		__atomic_exchange_n(&mod->rebuild, 0, __ATOMIC_SEQ_CST)) {
+		take_back_groups(mod);
+	}
+
+	while (group_fifo_depth(fifo) < GROUP_LOOKAHEAD) {
+		get_group_bits(mod, stream_num, bits);
+		group_fifo_push(fifo, bits);
+	}
+}
+
+/* Sleep until the modulator has used up part of the look-ahead. Returns
+ * -1 once the FIFOs have been closed.
+ */
+int8_t wait_rds_group_fifo(struct rds_modulator_t *mod, uint8_t stream_num) {
+	return group_fifo_wait(&mod->group_fifos[stream_num], GROUP_REFILL_LEVEL);
+}
+
+/* Wake up everything waiting on the group FIFOs for shutdown */
+void close_rds_group_fifos(struct rds_modulator_t *mod) {
+	for (uint8_t i = 0; i < NUM_RDS_STREAMS; i++) {
+		close_group_fifo(&mod->group_fifos[i]);
 	}
+	close_group_fifo(&mod->input_fifo);
 }
 
-static struct rds_context rds_contexts[4];
+void fill_rds_group_fifos(struct rds_modulator_t *mod) {
+	for (uint8_t i = 0; i < mod->num_streams; i++) {
+		fill_rds_group_fifo(mod, i);
+	}
+}
+
+/* Switch the modulator over to the group FIFOs. From here on the encoder
+ * must only be called through fill_rds_group_fifo(s).
+ */
+void enable_rds_group_fifos(struct rds_modulator_t *mod) {
+	fill_rds_group_fifos(mod);
+	__atomic_store_n(&mod->use_group_fifos, 1, __ATOMIC_RELEASE);
+}
+
+/* Have the groups queued on the basic stream built again, as far as
+ * they haven't gone out yet. Safe from any thread.
+ */
+void rebuild_rds_group_fifo(struct rds_modulator_t *mod) {
+	if (!__atomic_load_n(&mod->use_group_fifos, __ATOMIC_ACQUIRE)) return;
+
+	__atomic_store_n(&mod->rebuild, 1, __ATOMIC_SEQ_CST);
+	poke_group_fifo(&mod->group_fifos[0]);
+}
+
+uint16_t get_rds_group_fifo_depth(struct rds_modulator_t *mod,
+	uint8_t stream_num) {
+	return group_fifo_depth(&mod->group_fifos[stream_num]);
+}
+
+uint32_t get_rds_group_fifo_underruns(struct rds_modulator_t *mod,
+	uint8_t stream_num) {
+	return __atomic_load_n(&mod->contexts[stream_num].underruns,
+		__ATOMIC_RELAXED);
+}
+
+void enable_rds_group_input(struct rds_modulator_t *mod) {
+	__atomic_store_n(&mod->use_group_input, 1, __ATOMIC_RELEASE);
+}
+
+/* Queue a group from the group input. Returns 0 if the buffer is full. */
+uint8_t push_rds_input_group(struct rds_modulator_t *mod, uint64_t *bits) {
+	return group_fifo_push(&mod->input_fifo, bits);
+}
+
+/* Sleep until there is room in the input buffer. Returns -1 once the
+ * FIFOs have been closed.
+ */
+int8_t wait_rds_input_room(struct rds_modulator_t *mod) {
+	return group_fifo_wait(&mod->input_fifo, GROUP_FIFO_SIZE - 1);
+}
+
+uint16_t get_rds_input_depth(struct rds_modulator_t *mod) {
+	return group_fifo_depth(&mod->input_fifo);
+}
+
+uint32_t get_rds_input_underruns(struct rds_modulator_t *mod) {
+	return __atomic_load_n(&mod->input_underruns, __ATOMIC_RELAXED);
+}
+
+static uint8_t get_input_group(struct rds_modulator_t *mod, uint64_t *bits) {
+	if (!mod->input_primed) {
+		if (group_fifo_depth(&mod->input_fifo) < INPUT_PREFILL) return 0;
+		mod->input_primed = 1;
+	}
+
+	if (!group_fifo_pop(&mod->input_fifo, bits)) {
+		mod->input_primed = 0;
+		__atomic_store_n(&mod->input_underruns, mod->input_underruns + 1,
+			__ATOMIC_RELAXED);
+		return 0;
+	}
+
+	return 1;
+}
+
+static void get_next_group(struct rds_modulator_t *mod, uint8_t stream_num,
+	uint64_t *bits) {
+	uint64_t local[GROUP_WORDS];
+
+	/* The local groups are taken in step with the input groups that
+	 * replace them and thrown away. This keeps the group hooks and the
+	 * CT clock running, and after an underrun the local groups sent
+	 * are as fresh as they would have been without the input.
+	 */
+	if (stream_num == 0 &&
+		__atomic_load_n(&mod->use_group_input, __ATOMIC_ACQUIRE)) {
+		if (get_input_group(mod, bits)) bits = local;
+	}
+
+	if (!__atomic_load_n(&mod->use_group_fifos, __ATOMIC_ACQUIRE)) {
+		get_group_bits(mod, stream_num, bits);
+		return;
+	}
+
+	/* If the producer fell behind, send the last group again rather
+	 * than running the encoder on this thread. Receivers simply see
+	 * a repeated group.
+	 */
+	if (!group_fifo_pop(&mod->group_fifos[stream_num], bits)) {
+		__atomic_store_n(&mod->contexts[stream_num].underruns,
+			mod->contexts[stream_num].underruns + 1,
+			__ATOMIC_RELAXED);
+	}
+}
 
 /* Get an RDS sample. This generates the envelope of the waveform using
- * pre-generated elementary waveform samples.
+ * pre-rendered bit waveforms.
  */
-float get_rds_sample(uint8_t stream_num) {
-	struct rds_context *rds = &rds_contexts[stream_num];
+float get_rds_sample(struct rds_modulator_t *mod, uint8_t stream_num) {
+	struct rds_context *rds = &mod->contexts[stream_num];
+
+	if (stream_num >= mod->num_streams) return 0.0f;
 
 	if (rds->sample_count == SAMPLES_PER_BIT) {
 		if (rds->bit_pos == BITS_PER_GROUP) {
-#ifdef RDS2
-			if (stream_num > 0) {
-				get_rds2_bits(stream_num, rds->bit_buffer);
-			} else {
-				get_rds_bits(rds->bit_buffer);
-			}
-#else
-			get_rds_bits(rds->bit_buffer);
-#endif
+			get_next_group(mod, stream_num, rds->group);
 			rds->bit_pos = 0;
 		}
-
 		// do differential encoding
-		rds->cur_bit = rds->bit_buffer[rds->bit_pos++];
+		// (the group is left intact so it can be repeated)
+		rds->cur_bit = (rds->group[rds->bit_pos >> 6] >>
+			(63 - (rds->bit_pos & 63))) & 1;
+		rds->bit_pos++;
+		// the basic stream keeps the clock time in step
+		if (stream_num == 0) {
+			__atomic_store_n(&mod->enc->bits_sent,
+				mod->enc->bits_sent + 1, __ATOMIC_RELAXED);
+		}
 		rds->prev_output = rds->cur_output;
 		rds->cur_output = rds->prev_output ^ rds->cur_bit;
-
-		uint16_t idx = rds->in_sample_index;
-
-		for (uint16_t j = 0; j < FILTER_SIZE; j++) {
-			rds->sample_buffer[idx++] +=
-				sym_waveforms[rds->cur_output][j];
-			if (idx == SAMPLE_BUFFER_SIZE) idx = 0;
-		}
-
-		rds->in_sample_index += SAMPLES_PER_BIT;
-		if (rds->in_sample_index == SAMPLE_BUFFER_SIZE)
-			rds->in_sample_index = 0;
-
+		rds->symbols = (rds->symbols << 1 | rds->cur_output) &
+			(NUM_SYMBOL_WINDOWS - 1);
+		rds->waveform = bit_waveforms[rds->symbols];
 		rds->sample_count = 0;
 	}
-	rds->sample_count++;
-
-	rds->sample = rds->sample_buffer[rds->out_sample_index];
-	rds->sample_buffer[rds->out_sample_index++] = 0;
-	if (rds->out_sample_index == SAMPLE_BUFFER_SIZE)
-		rds->out_sample_index = 0;
 
+	rds->sample = rds->waveform[rds->sample_count++];
 	return rds->sample;
 }
@@ -16,22 +16,106 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef RDS_MODULATOR_H
+#define RDS_MODULATOR_H
+
 #include "rds.h"
+#include "group_fifo.h"
+#include "arena.h"
+
+/* Number of bit periods a symbol waveform spans */
+#define SYMBOL_SPAN		(FILTER_SIZE / SAMPLES_PER_BIT)
+#define NUM_SYMBOL_WINDOWS	(1 << SYMBOL_SPAN)
+
+#ifdef RDS2
+#define NUM_RDS_STREAMS		4
+#else
+#define NUM_RDS_STREAMS		1
+#endif
+
+/* Groups kept ready ahead of the modulator (about 350 ms) */
+#define GROUP_LOOKAHEAD		4
+
+/* The producer is woken when this many are left, so it encodes a few
+ * groups at a time instead of one per wakeup
+ */
+#define GROUP_REFILL_LEVEL	(GROUP_LOOKAHEAD / 2)
+
+/* Input groups buffered before they are sent */
+#define INPUT_PREFILL		4
 
 // RDS signal context
 typedef struct rds_context {
-	uint8_t bit_buffer[BITS_PER_GROUP];
+	uint64_t group[GROUP_WORDS];
 	uint8_t bit_pos;
-	float sample_buffer[SAMPLE_BUFFER_SIZE];
 	uint8_t prev_output;
 	uint8_t cur_output;
 	uint8_t cur_bit;
 	uint8_t sample_count;
-	uint16_t in_sample_index;
-	uint16_t out_sample_index;
-	float sample_pos;
+	// last SYMBOL_SPAN differential symbols, newest in bit 0
+	uint8_t symbols;
+	float *waveform;
 	float sample;
+	// groups sent again because the FIFO ran dry
+	uint32_t underruns;
 } rds_context;
 
-extern void init_symbol_waveforms();
-extern void exit_symbol_waveforms();
+/*
+ * RDS modulator
+ *
+ * Turns the groups of one encoder (and on one of them, the RDS2
+ * encoder) into the RDS signals.
+ */
+typedef struct rds_modulator_t {
+	struct rds_encoder_t *enc;
+	struct rds_context contexts[NUM_RDS_STREAMS];
+	// streams modulated, the others are silent
+	uint8_t num_streams;
+
+	/* Look-ahead group FIFOs
+	 *
+	 * When enabled, groups are encoded ahead of time by a producer
+	 * thread so the modulator only has to pop them.
+	 */
+	struct group_fifo_t group_fifos[NUM_RDS_STREAMS];
+	uint8_t use_group_fifos;
+	// the basic stream's look-ahead is to be built again
+	uint8_t rebuild;
+
+	/* Jitter buffer for groups from the group input
+	 *
+	 * Input groups replace the locally encoded ones on the basic
+	 * stream, which are still taken and thrown away. After an
+	 * underrun the local groups are sent until the buffer has filled
+	 * up again.
+	 */
+	struct group_fifo_t input_fifo;
+	uint8_t use_group_input;
+	uint8_t input_primed;
+	uint32_t input_underruns;
+} rds_modulator_t;
+
+extern void init_symbol_waveforms(struct arena_t *arena);
+extern void init_rds_modulator(struct rds_modulator_t *mod,
+	struct rds_encoder_t *enc, uint8_t num_streams);
+extern float get_rds_sample(struct rds_modulator_t *mod, uint8_t stream_num);
+extern void fill_rds_group_fifo(struct rds_modulator_t *mod,
+	uint8_t stream_num);
+extern int8_t wait_rds_group_fifo(struct rds_modulator_t *mod,
+	uint8_t stream_num);
+extern void close_rds_group_fifos(struct rds_modulator_t *mod);
+extern void fill_rds_group_fifos(struct rds_modulator_t *mod);
+extern void enable_rds_group_fifos(struct rds_modulator_t *mod);
+extern void rebuild_rds_group_fifo(struct rds_modulator_t *mod);
+extern uint16_t get_rds_group_fifo_depth(struct rds_modulator_t *mod,
+	uint8_t stream_num);
+extern uint32_t get_rds_group_fifo_underruns(struct rds_modulator_t *mod,
+	uint8_t stream_num);
+extern void enable_rds_group_input(struct rds_modulator_t *mod);
+extern uint8_t push_rds_input_group(struct rds_modulator_t *mod,
+	uint64_t *bits);
+extern int8_t wait_rds_input_room(struct rds_modulator_t *mod);
+extern uint16_t get_rds_input_depth(struct rds_modulator_t *mod);
+extern uint32_t get_rds_input_underruns(struct rds_modulator_t *mod);
+
+#endif /* RDS_MODULATOR_H */
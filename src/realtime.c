@@ -0,0 +1,276 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// for CPU sets and pthread_setaffinity_np
+#define _GNU_SOURCE
+#include "common.h"
+#include <errno.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include "realtime.h"
+
+// stack the main thread touches up front when memory is locked
+#define PREFAULT_STACK_SIZE	(256 * 1024)
+
+static const char *stage_names[NUM_STAGES] = {
+	"input", "resampler", "mpx", "output"
+};
+
+// 0 runs a stage with normal scheduling
+static uint8_t stage_priority[NUM_STAGES];
+static int rt_policy = SCHED_FIFO;
+// empty sets leave a stage wherever the scheduler puts it
+static cpu_set_t stage_cpus[NUM_STAGES];
+static cpu_set_t isolated_cpus;
+static uint8_t lock_memory;
+
+/* Call set for every STAGE=VALUE item of a comma separated list.
+ * "all" applies the value to every stage.
+ */
+static int8_t parse_stage_list(char *list,
+	int8_t (*set)(uint8_t stage, char *value)) {
+	char buf[128];
+	char *item, *value, *save;
+	uint8_t stage;
+
+	strncpy(buf, list, 127);
+	buf[127] = 0;
+
+	for (item = strtok_r(buf, ",", &save); item != NULL;
+		item = strtok_r(NULL, ",", &save)) {
+		value = strchr(item, '=');
+		if (value == NULL) {
+			fprintf(stderr, "Expected STAGE=VALUE, got \"%s\".\n", item);
+			return -1;
+		}
+		*value++ = 0;
+
+		if (strcmp(item, "all") == 0) {
+			for (stage = 0; stage < NUM_STAGES; stage++) {
+				if (set(stage, value) < 0) return -1;
+			}
+			continue;
+		}
+
+		for (stage = 0; stage < NUM_STAGES; stage++) {
+			if (strcmp(item, stage_names[stage]) == 0) break;
+		}
+		if (stage == NUM_STAGES) {
+			fprintf(stderr, "Unknown stage \"%s\". Valid stages are "
+				"input, resampler, mpx, output and all.\n", item);
+			return -1;
+		}
+		if (set(stage, value) < 0) return -1;
+	}
+
+	return 0;
+}
+
+static int8_t parse_cpu_mask(char *mask, cpu_set_t *cpus) {
+	char *end;
+	uint64_t bits = strtoull(mask, &end, 16);
+
+	if (*end || !bits) {
+		fprintf(stderr, "Invalid CPU mask \"%s\".\n", mask);
+		return -1;
+	}
+
+	CPU_ZERO(cpus);
+	for (uint8_t i = 0; i < 64; i++) {
+		if (bits >> i & 1) CPU_SET(i, cpus);
+	}
+
+	return 0;
+}
+
+// first 64 CPUs of a set as a hex mask, for reporting
+static uint64_t cpu_mask(cpu_set_t *cpus) {
+	uint64_t bits = 0;
+
+	for (uint8_t i = 0; i < 64; i++) {
+		if (CPU_ISSET(i, cpus)) bits |= 1ULL << i;
+	}
+
+	return bits;
+}
+
+static int8_t set_stage_priority(uint8_t stage, char *value) {
+	char *end;
+	unsigned long priority = strtoul(value, &end, 10);
+
+	if (*end || priority > 99) {
+		fprintf(stderr, "Priority must be between 1 - 99, "
+			"or 0 for normal scheduling.\n");
+		return -1;
+	}
+	stage_priority[stage] = priority;
+
+	return 0;
+}
+
+int8_t set_rt_priorities(char *list) {
+	return parse_stage_list(list, set_stage_priority);
+}
+
+int8_t set_rt_policy(char *name) {
+	if (strcmp(name, "fifo") == 0) {
+		rt_policy = SCHED_FIFO;
+	} else if (strcmp(name, "rr") == 0) {
+		rt_policy = SCHED_RR;
+	} else {
+		fprintf(stderr, "Scheduling policy must be fifo or rr.\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int8_t set_stage_mask(uint8_t stage, char *value) {
+	return parse_cpu_mask(value, &stage_cpus[stage]);
+}
+
+int8_t set_stage_cpus(char *list) {
+	return parse_stage_list(list, set_stage_mask);
+}
+
+int8_t set_isolated_cpus(char *mask) {
+	return parse_cpu_mask(mask, &isolated_cpus);
+}
+
+void set_memory_lock(uint8_t on) {
+	lock_memory = on;
+}
+
+static void prefault_stack() {
+	volatile uint8_t stack[PREFAULT_STACK_SIZE];
+	long page_size = sysconf(_SC_PAGESIZE);
+
+	for (size_t i = 0; i < PREFAULT_STACK_SIZE; i += page_size) {
+		stack[i] = 0;
+	}
+	(void)stack[0];
+}
+
+/* Apply the process wide settings. Must be called before any thread is
+ * created, since new threads inherit the CPUs of the main thread and
+ * only get their stacks locked once memory is locked.
+ */
+int8_t init_realtime(pthread_attr_t *attr) {
+	cpu_set_t cpus;
+	struct rlimit limit;
+
+	if (CPU_COUNT(&isolated_cpus)) {
+		// everything but the pipeline stays off the isolated CPUs
+		if (sched_getaffinity(0, sizeof(cpu_set_t), &cpus) < 0) {
+			fprintf(stderr, "Could not get the CPUs: %s.\n",
+				strerror(errno));
+			return -1;
+		}
+		for (uint16_t i = 0; i < CPU_SETSIZE; i++) {
+			if (CPU_ISSET(i, &isolated_cpus)) CPU_CLR(i, &cpus);
+		}
+		if (!CPU_COUNT(&cpus)) {
+			fprintf(stderr, "No CPUs left for the other threads.\n");
+			return -1;
+		}
+		if (sched_setaffinity(0, sizeof(cpu_set_t), &cpus) < 0) {
+			fprintf(stderr, "Could not move off the isolated CPUs: %s.\n",
+				strerror(errno));
+			return -1;
+		}
+		fprintf(stderr, "Reserved CPUs %#llx for the pipeline, "
+			"other threads run on %#llx.\n",
+			(unsigned long long)cpu_mask(&isolated_cpus),
+			(unsigned long long)cpu_mask(&cpus));
+	}
+
+	if (lock_memory) {
+		/* every later allocation counts against the limit and
+		 * fails once it is reached
+		 */
+		if (geteuid() != 0 && (getrlimit(RLIMIT_MEMLOCK, &limit) < 0 ||
+			limit.rlim_cur != RLIM_INFINITY)) {
+			fprintf(stderr, "Not locking memory, the locked memory "
+				"limit is too low (see ulimit -l).\n");
+		} else if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+			fprintf(stderr, "Could not lock memory: %s.\n",
+				strerror(errno));
+		} else {
+			prefault_stack();
+			pthread_attr_setstacksize(attr, LOCKED_STACK_SIZE);
+			fprintf(stderr, "Locked memory.\n");
+		}
+	}
+
+	return 0;
+}
+
+/* Give a pipeline thread its priority and CPUs and report what the
+ * system actually granted. A stage that can't get real-time priority
+ * keeps running with normal scheduling.
+ */
+void set_stage_thread(pthread_t thread, uint8_t stage, char *name) {
+	struct sched_param param;
+	cpu_set_t *cpus = NULL;
+	cpu_set_t granted;
+	int policy;
+	int r;
+
+	if (CPU_COUNT(&stage_cpus[stage])) {
+		cpus = &stage_cpus[stage];
+	} else if (CPU_COUNT(&isolated_cpus)) {
+		cpus = &isolated_cpus;
+	}
+
+	if (!stage_priority[stage] && cpus == NULL) return;
+
+	if (stage_priority[stage]) {
+		memset(&param, 0, sizeof(struct sched_param));
+		param.sched_priority = stage_priority[stage];
+		r = pthread_setschedparam(thread, rt_policy, &param);
+		if (r != 0) {
+			fprintf(stderr, "Could not give the %s thread real-time "
+				"priority %u: %s.\n", name, stage_priority[stage],
+				strerror(r));
+		}
+	}
+
+	if (cpus) {
+		r = pthread_setaffinity_np(thread, sizeof(cpu_set_t), cpus);
+		if (r != 0) {
+			fprintf(stderr, "Could not move the %s thread to CPUs "
+				"%#llx: %s.\n", name,
+				(unsigned long long)cpu_mask(cpus), strerror(r));
+		}
+	}
+
+	if (pthread_getschedparam(thread, &policy, &param) != 0 ||
+		pthread_getaffinity_np(thread, sizeof(cpu_set_t), &granted) != 0)
+		return;
+
+	if (policy == SCHED_FIFO || policy == SCHED_RR) {
+		fprintf(stderr, "The %s thread runs %s priority %d on CPUs %#llx.\n",
+			name, policy == SCHED_FIFO ? "SCHED_FIFO" : "SCHED_RR",
+			param.sched_priority, (unsigned long long)cpu_mask(&granted));
+	} else {
+		fprintf(stderr, "The %s thread runs with normal scheduling "
+			"on CPUs %#llx.\n", name,
+			(unsigned long long)cpu_mask(&granted));
+	}
+}
@@ -0,0 +1,41 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+
+/* Pipeline stages that can be given real-time priority and CPUs */
+enum {
+	STAGE_INPUT,
+	STAGE_RESAMPLER,
+	STAGE_MPX,
+	STAGE_OUTPUT,
+	NUM_STAGES
+};
+
+/* Stack size of the threads when memory is locked. The default of 8 MB
+ * per thread would all have to be locked.
+ */
+#define LOCKED_STACK_SIZE	(256 * 1024)
+
+extern int8_t set_rt_priorities(char *list);
+extern int8_t set_rt_policy(char *name);
+extern int8_t set_stage_cpus(char *list);
+extern int8_t set_isolated_cpus(char *mask);
+extern void set_memory_lock(uint8_t on);
+extern int8_t init_realtime(pthread_attr_t *attr);
+extern void set_stage_thread(pthread_t thread, uint8_t stage, char *name);
@@ -32,18 +32,17 @@ int8_t resampler_init(SRC_STATE **src_state, uint8_t channels) {
 	return 0;
 }
 
-int8_t resample(SRC_STATE *src_state, SRC_DATA src_data, size_t *frames_generated) {
+/* The frames used and generated are returned in src_data */
+int8_t resample(SRC_STATE *src_state, SRC_DATA *src_data) {
 	int src_error;
 
-	src_error = src_process(src_state, &src_data);
+	src_error = src_process(src_state, src_data);
 
 	if (src_error) {
 		fprintf(stderr, "Error: src_process failed: %s\n", src_strerror(src_error));
 		return -1;
 	}
 
-	*frames_generated = src_data.output_frames_gen;
-
 	return 0;
 }
 
@@ -0,0 +1,149 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <time.h>
+#include "schedule.h"
+
+/*
+ * Scheduled control commands
+ *
+ * Commands can be given a wall clock time at which they should be on
+ * air. They are run by the encoder right before it builds the group that
+ * starts closest to that time, so e.g. a new RT goes out at the right
+ * group no matter when the command was received.
+ *
+ * New commands are handed over through a short queue and placed in a
+ * timer wheel keyed by the group index by the encoder itself, which owns
+ * the clock that maps times to groups. Each slot holds the commands due
+ * in groups with that index modulo SCHEDULE_SLOTS, so only one slot is
+ * looked at per group. Commands further ahead than the wheel spans wait
+ * in their slot for the next turns.
+ *
+ * Groups are built a few hundred ms before they go on air. A command due
+ * in a group that has been built already has the queued groups taken
+ * back and built again, so it still lands in its group as long as that
+ * hasn't gone out. Otherwise it runs in the first group that can still
+ * be changed, which is at most one group after the one on air.
+ */
+
+static uint8_t run_scheduled_commands(void *arg, uint64_t group) {
+	struct command_schedule_t *sched = arg;
+	struct scheduled_command_t *entries = sched->entries;
+	int16_t i, next, *link;
+	uint8_t count = 0;
+
+	pthread_mutex_lock(&sched->mutex);
+	for (i = sched->incoming; i != -1; i = next) {
+		next = entries[i].next;
+		entries[i].group = get_rds_group_at(sched->enc, entries[i].time);
+		/* late commands go out right away, the groups before this
+		 * one have gone out or can't be changed anymore
+		 */
+		if (entries[i].group < group) entries[i].group = group;
+		// append so commands for the same group keep their order
+		for (link = &sched->wheel[entries[i].group % SCHEDULE_SLOTS];
+			*link != -1; link = &entries[*link].next);
+		*link = i;
+		entries[i].next = -1;
+	}
+	sched->incoming = -1;
+	pthread_mutex_unlock(&sched->mutex);
+
+	link = &sched->wheel[group % SCHEDULE_SLOTS];
+	while ((i = *link) != -1) {
+		if (entries[i].group > group) {
+			link = &entries[i].next;
+			continue;
+		}
+
+		*link = entries[i].next;
+		sched->run_command(sched->arg, entries[i].cmd);
+		count++;
+
+		pthread_mutex_lock(&sched->mutex);
+		entries[i].next = sched->free_list;
+		sched->free_list = i;
+		pthread_mutex_unlock(&sched->mutex);
+	}
+
+	return count;
+}
+
+void init_command_schedule(struct command_schedule_t *sched,
+	struct rds_modulator_t *mod, int (*run)(void *arg, char *cmd), void *arg) {
+	memset(sched, 0, sizeof(struct command_schedule_t));
+	pthread_mutex_init(&sched->mutex, NULL);
+	for (uint16_t i = 0; i < SCHEDULE_SLOTS; i++) sched->wheel[i] = -1;
+	for (int16_t i = 0; i < MAX_SCHEDULED; i++) sched->entries[i].next = i - 1;
+	sched->free_list = MAX_SCHEDULED - 1;
+	sched->incoming = -1;
+
+	sched->enc = mod->enc;
+	sched->mod = mod;
+	sched->run_command = run;
+	sched->arg = arg;
+	add_rds_group_hook(sched->enc, run_scheduled_commands, sched);
+}
+
+/* Time audio takes from the input to the air: buffering before the MPX
+ * stage plus the output latency of the RDS signal
+ */
+void set_command_latency(struct command_schedule_t *sched,
+	float latency) {
+	sched->latency = latency;
+}
+
+int8_t schedule_command(struct command_schedule_t *sched, double time,
+	char *cmd) {
+	struct scheduled_command_t *entries = sched->entries;
+	int16_t i, *link;
+
+	pthread_mutex_lock(&sched->mutex);
+	if (sched->free_list == -1) {
+		pthread_mutex_unlock(&sched->mutex);
+		fprintf(stderr, "Could not schedule command.\n");
+		return -1;
+	}
+	i = sched->free_list;
+	sched->free_list = entries[i].next;
+
+	entries[i].time = time;
+	strncpy(entries[i].cmd, cmd, SCHEDULE_CMD_SIZE - 1);
+	entries[i].cmd[SCHEDULE_CMD_SIZE - 1] = 0;
+	entries[i].next = -1;
+
+	// keep the incoming commands in order
+	for (link = &sched->incoming; *link != -1; link = &entries[*link].next);
+	*link = i;
+	pthread_mutex_unlock(&sched->mutex);
+
+	// due in a group that has been built already
+	if (time < get_rds_build_time(sched->enc))
+		rebuild_rds_group_fifo(sched->mod);
+
+	return 0;
+}
+
+int8_t schedule_command_now(struct command_schedule_t *sched, char *cmd) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	return schedule_command(sched, now.tv_sec + now.tv_nsec / 1e9 +
+		sched->latency, cmd);
+}
@@ -0,0 +1,66 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include <pthread.h>
+#include "rds.h"
+#include "rds_modulator.h"
+
+#define SCHEDULE_SLOTS		256
+#define MAX_SCHEDULED		64
+#define SCHEDULE_CMD_SIZE	100
+
+typedef struct scheduled_command_t {
+	double time;
+	uint64_t group;
+	char cmd[SCHEDULE_CMD_SIZE];
+	// next entry in the same slot, -1 for none
+	int16_t next;
+} scheduled_command_t;
+
+// commands scheduled on one encoder
+typedef struct command_schedule_t {
+	struct scheduled_command_t entries[MAX_SCHEDULED];
+	int16_t free_list;
+	// received but not placed in the wheel yet
+	int16_t incoming;
+	pthread_mutex_t mutex;
+
+	// only touched by the encoder
+	int16_t wheel[SCHEDULE_SLOTS];
+
+	struct rds_encoder_t *enc;
+	struct rds_modulator_t *mod;
+	int (*run_command)(void *arg, char *cmd);
+	void *arg;
+
+	// time audio takes from being read to the air
+	float latency;
+} command_schedule_t;
+
+extern void init_command_schedule(struct command_schedule_t *sched,
+	struct rds_modulator_t *mod, int (*run)(void *arg, char *cmd), void *arg);
+extern void set_command_latency(struct command_schedule_t *sched,
+	float latency);
+extern int8_t schedule_command(struct command_schedule_t *sched, double time,
+	char *cmd);
+extern int8_t schedule_command_now(struct command_schedule_t *sched, char *cmd);
+
+#endif /* SCHEDULE_H */
@@ -0,0 +1,162 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include "sequencer.h"
+
+/*
+ * Command sequencer
+ *
+ * Runs a playlist of control commands in a loop, each followed by a
+ * dwell time, e.g. to rotate PS texts or cycle RT messages without an
+ * external script. The playlist is timed in groups by the encoder and
+ * its commands run right before a group is built, so a change never
+ * lands in the middle of a group and the timing does not depend on
+ * when a thread gets to run.
+ *
+ * A playlist file has one entry per line: the dwell time in seconds and
+ * a control command. Commands with a dwell time of 0 go out together with
+ * the next one, e.g. RT+ tags with their RT. Empty lines and lines
+ * starting with # are skipped.
+ *
+ *	0 RT Now playing: Artist - Title
+ *	10 RTP 4,13,5,1,21,4
+ *	3 PS Mpxgen
+ *	3 PS Radio
+ */
+
+/* Run the entries due in this group
+ * Returns the number of commands run
+ */
+static uint8_t run_sequence(void *arg, uint64_t group) {
+	struct command_sequencer_t *seq = arg;
+	char cmd[SEQUENCE_CMD_SIZE];
+	uint32_t dwell;
+	uint16_t num_entries;
+	uint8_t count = 0;
+
+	do {
+		pthread_mutex_lock(&seq->mutex);
+		if (seq->restart) {
+			seq->next = 0;
+			seq->next_group = group;
+			seq->restart = 0;
+		}
+		num_entries = seq->num_entries;
+		if (num_entries == 0 || group < seq->next_group) {
+			pthread_mutex_unlock(&seq->mutex);
+			break;
+		}
+
+		memcpy(cmd, seq->entries[seq->next].cmd, SEQUENCE_CMD_SIZE);
+		dwell = seq->entries[seq->next].dwell;
+		seq->next_group = group + dwell;
+		if (++seq->next == seq->num_entries) seq->next = 0;
+		pthread_mutex_unlock(&seq->mutex);
+
+		// outside the lock, the command may load another sequence
+		seq->run_command(seq->arg, cmd);
+		count++;
+	// a playlist without any dwell time runs once per group
+	} while (dwell == 0 && count < num_entries);
+
+	return count;
+}
+
+void init_command_sequencer(struct command_sequencer_t *seq,
+	struct rds_encoder_t *enc, int (*run)(void *arg, char *cmd), void *arg) {
+	memset(seq, 0, sizeof(struct command_sequencer_t));
+	pthread_mutex_init(&seq->mutex, NULL);
+	seq->run_command = run;
+	seq->arg = arg;
+	add_rds_group_hook(enc, run_sequence, seq);
+}
+
+int8_t load_command_sequence(struct command_sequencer_t *seq, char *file) {
+	struct sequence_entry_t *entries, *old_entries;
+	uint16_t num_entries = 0;
+	char line[SEQUENCE_CMD_SIZE + 16];
+	char *cmd;
+	float dwell;
+	FILE *f;
+
+	f = fopen(file, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Could not open sequence %s.\n", file);
+		return -1;
+	}
+
+	entries = malloc(MAX_SEQUENCE_ENTRIES * sizeof(struct sequence_entry_t));
+	if (entries == NULL) {
+		fclose(f);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#' || line[0] == '\n') continue;
+		line[strcspn(line, "\r\n")] = 0;
+
+		dwell = strtof(line, &cmd);
+		while (*cmd == ' ' || *cmd == '\t') cmd++;
+		if (cmd == line || *cmd == 0 || dwell < 0) {
+			fprintf(stderr, "Skipping bad sequence line \"%s\".\n", line);
+			continue;
+		}
+		if (num_entries == MAX_SEQUENCE_ENTRIES) {
+			fprintf(stderr, "Sequence %s has too many entries.\n", file);
+			break;
+		}
+
+		strncpy(entries[num_entries].cmd, cmd, SEQUENCE_CMD_SIZE - 1);
+		entries[num_entries].cmd[SEQUENCE_CMD_SIZE - 1] = 0;
+		entries[num_entries].dwell = lroundf(dwell * RDS_GROUP_RATE);
+		num_entries++;
+	}
+	fclose(f);
+
+	if (num_entries == 0) {
+		fprintf(stderr, "Sequence %s is empty.\n", file);
+		free(entries);
+		return -1;
+	}
+
+	pthread_mutex_lock(&seq->mutex);
+	old_entries = seq->entries;
+	seq->entries = entries;
+	seq->num_entries = num_entries;
+	seq->restart = 1;
+	pthread_mutex_unlock(&seq->mutex);
+
+	free(old_entries);
+	fprintf(stderr, "Loaded sequence %s with %u entries.\n", file,
+		num_entries);
+
+	return 0;
+}
+
+void stop_command_sequence(struct command_sequencer_t *seq) {
+	struct sequence_entry_t *old_entries;
+
+	pthread_mutex_lock(&seq->mutex);
+	old_entries = seq->entries;
+	seq->entries = NULL;
+	seq->num_entries = 0;
+	pthread_mutex_unlock(&seq->mutex);
+
+	free(old_entries);
+}
@@ -0,0 +1,55 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include <pthread.h>
+#include "rds.h"
+
+#define MAX_SEQUENCE_ENTRIES	128
+#define SEQUENCE_CMD_SIZE	100
+
+typedef struct sequence_entry_t {
+	char cmd[SEQUENCE_CMD_SIZE];
+	// groups to wait before the next entry
+	uint32_t dwell;
+} sequence_entry_t;
+
+// the playlist of one encoder
+typedef struct command_sequencer_t {
+	struct sequence_entry_t *entries;
+	uint16_t num_entries;
+	// entry run next and the group to run it in
+	uint16_t next;
+	uint64_t next_group;
+	// start over from the first entry
+	uint8_t restart;
+	pthread_mutex_t mutex;
+
+	int (*run_command)(void *arg, char *cmd);
+	void *arg;
+} command_sequencer_t;
+
+extern void init_command_sequencer(struct command_sequencer_t *seq,
+	struct rds_encoder_t *enc, int (*run)(void *arg, char *cmd), void *arg);
+extern int8_t load_command_sequence(struct command_sequencer_t *seq,
+	char *file);
+extern void stop_command_sequence(struct command_sequencer_t *seq);
+
+#endif /* SEQUENCER_H */
@@ -18,6 +18,7 @@
 
 #include "common.h"
 #include "ssb.h"
+#include "arena.h"
 
 /*
  * Hilbert transform FIR filter
@@ -29,15 +30,16 @@
  * https://github.com/MikeCurrington/mkfilter/
  */
 
-void init_hilbert_transformer(struct hilbert_fir_t *flt, uint16_t size) {
+void init_hilbert_transformer(struct hilbert_fir_t *flt, uint16_t size,
+	struct arena_t *arena) {
 	uint16_t half_size = size / 2;
 	double filter, window;
 	uint8_t odd = 0;
 
 	memset(flt, 0, sizeof(struct hilbert_fir_t));
 	flt->num_coeffs = size + 1;
-	flt->coeffs = malloc(flt->num_coeffs * sizeof(float));
-	flt->in_buffer = malloc(flt->num_coeffs * sizeof(float));
+	flt->coeffs = alloc_from_arena(arena, flt->num_coeffs * sizeof(float));
+	flt->in_buffer = alloc_from_arena(arena, flt->num_coeffs * sizeof(float));
 
 	// start from the center
 	for (uint16_t i = 1; i < half_size + 1; i++) {
@@ -74,6 +76,18 @@ void init_hilbert_transformer(struct hilbert_fir_t *flt, uint16_t size) {
 #endif
 }
 
+/* Set up a filter on the coefficients of another one, only the input
+ * buffer is its own
+ */
+void share_hilbert_transformer(struct hilbert_fir_t *flt,
+	const struct hilbert_fir_t *tables, struct arena_t *arena) {
+	memset(flt, 0, sizeof(struct hilbert_fir_t));
+	flt->num_coeffs = tables->num_coeffs;
+	flt->coeffs = tables->coeffs;
+	flt->gain = tables->gain;
+	flt->in_buffer = alloc_from_arena(arena, flt->num_coeffs * sizeof(float));
+}
+
 float get_hilbert(struct hilbert_fir_t *flt, float in) {
 	float filter_out;
 	uint16_t filter_idx;
@@ -91,8 +105,3 @@ float get_hilbert(struct hilbert_fir_t *flt, float in) {
 
 	return filter_out;
 }
-
-void exit_hilbert_transformer(struct hilbert_fir_t *flt) {
-	free(flt->coeffs);
-	free(flt->in_buffer);
-}
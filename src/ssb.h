@@ -16,6 +16,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef SSB_H
+#define SSB_H
+
+#include "arena.h"
+
 /*
  * Object for a Hilbert transform filter
  *
@@ -28,6 +33,10 @@ typedef struct hilbert_fir_t {
 	uint16_t flt_buffer_idx;
 } hilbert_fir_t;
 
-extern void init_hilbert_transformer(struct hilbert_fir_t *flt, uint16_t size);
+extern void init_hilbert_transformer(struct hilbert_fir_t *flt, uint16_t size,
+	struct arena_t *arena);
+extern void share_hilbert_transformer(struct hilbert_fir_t *flt,
+	const struct hilbert_fir_t *tables, struct arena_t *arena);
 extern float get_hilbert(struct hilbert_fir_t *flt, float in);
-extern void exit_hilbert_transformer(struct hilbert_fir_t *flt);
+
+#endif /* SSB_H */
@@ -0,0 +1,188 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+
+#include "rds.h"
+#include "rds_lib.h"
+#include "audio_conversion.h"
+#include "station.h"
+#include "arena.h"
+#include "buffers.h"
+
+/* Build the tables all stations share. Called once after the arena is
+ * set up, before the first station.
+ */
+void init_station_tables() {
+	init_checkword_tables();
+	init_symbol_waveforms(get_arena());
+	init_mpx_tables(get_arena());
+}
+
+static int run_command(void *arg, char *cmd) {
+	return process_control_command((struct station_t *)arg, cmd);
+}
+
+/* Set up a station with the default RDS data. Only the streams up to
+ * rds_streams are modulated.
+ */
+void init_station(struct station_t *st, uint8_t rds_streams) {
+	memset(st, 0, sizeof(struct station_t));
+
+	init_rds_encoder(&st->rds);
+	init_rds_modulator(&st->modulator, &st->rds, rds_streams);
+	fm_mpx_init(&st->mpx, &st->modulator, get_arena());
+	init_command_schedule(&st->schedule, &st->modulator, run_command, st);
+	init_command_sequencer(&st->sequencer, &st->rds, run_command, st);
+	st->ctl.fd = -1;
+}
+
+/* Memory the buffers of a single-thread pipeline need at most, see
+ * init_fused_pipeline
+ */
+size_t get_fused_pipeline_memory(size_t frames) {
+	size_t mpx, out;
+
+	mpx = MAX_BLOCK_FRAMES;
+	out = mpx * OUTPUT_SAMPLE_RATE / MPX_SAMPLE_RATE + 65;
+	return frames * 2 * (sizeof(short) + sizeof(float)) +
+		mpx * 2 * 2 * sizeof(float) +
+		out * 2 * (sizeof(float) + sizeof(short)) +
+		6 * ARENA_ALIGN;
+}
+
+/* Set up the single-thread pipeline of a station once its input, if
+ * any, and its resamplers are open. sample_rate is the rate of the
+ * audio input.
+ */
+int8_t init_fused_pipeline(struct station_t *st, size_t frames,
+	uint32_t sample_rate) {
+	struct fused_pipeline_t *pl = &st->pipeline;
+
+	pl->frames = frames;
+	if (st->in_src) {
+		pl->in_ratio = (double)MPX_SAMPLE_RATE / (double)sample_rate;
+	} else {
+		pl->in_ratio = 1.0;
+	}
+	pl->out_ratio = (double)OUTPUT_SAMPLE_RATE / (double)MPX_SAMPLE_RATE;
+
+	/* the resamplers may hand out a few frames more than the ratio,
+	 * anything that doesn't fit is taken through in a second round
+	 */
+	pl->mpx_frames = st->in_src ?
+		(size_t)(pl->frames * pl->in_ratio) + 64 : pl->frames;
+	if (pl->mpx_frames > MAX_BLOCK_FRAMES)
+		pl->mpx_frames = MAX_BLOCK_FRAMES;
+	pl->out_frames = (size_t)(pl->mpx_frames * pl->out_ratio) + 64;
+
+	if (st->in_src) {
+		pl->input = arena_alloc(pl->frames * 2 * sizeof(short));
+		pl->audio = arena_alloc(pl->frames * 2 * sizeof(float));
+		pl->resampled = arena_alloc(pl->mpx_frames * 2 * sizeof(float));
+		if (pl->input == NULL || pl->audio == NULL ||
+			pl->resampled == NULL) return -1;
+	}
+	pl->mpx = arena_alloc(pl->mpx_frames * 2 * sizeof(float));
+	pl->out = arena_alloc(pl->out_frames * 2 * sizeof(float));
+	pl->output = arena_alloc(pl->out_frames * 2 * sizeof(short));
+	if (pl->mpx == NULL || pl->out == NULL || pl->output == NULL)
+		return -1;
+
+	// one block on its way through plus what the resamplers hold
+	pl->ct_latency = 2.0f * pl->mpx_frames / MPX_SAMPLE_RATE;
+	set_rds_ct_latency(&st->rds, pl->ct_latency);
+	if (st->in_src) {
+		pl->audio_latency = 2.0f * pl->frames / sample_rate;
+		set_command_latency(&st->schedule,
+			pl->audio_latency + pl->ct_latency);
+	}
+
+	return 0;
+}
+
+/* Resample a block of MPX to the output rate and write it.
+ * A call may drain the resampler's own buffer without using any input,
+ * so keep going until the block is used up or nothing moves at all.
+ */
+static int8_t write_fused_block(struct station_t *st, size_t frames) {
+	struct fused_pipeline_t *pl = &st->pipeline;
+	SRC_DATA src_data;
+
+	if (!frames) return 0;
+
+	memset(&src_data, 0, sizeof(SRC_DATA));
+	src_data.src_ratio = pl->out_ratio;
+	src_data.data_in = pl->mpx;
+	src_data.input_frames = frames;
+
+	do {
+		src_data.data_out = pl->out;
+		src_data.output_frames = pl->out_frames;
+		if (resample(st->out_src, &src_data) < 0) return -1;
+
+		src_data.data_in += src_data.input_frames_used*2;
+		src_data.input_frames -= src_data.input_frames_used;
+		if (src_data.output_frames_gen) {
+			float2short(pl->out, pl->output,
+				src_data.output_frames_gen*2);
+			if (write_output(&st->output, pl->output,
+				src_data.output_frames_gen) < 0) return -1;
+		}
+	} while (src_data.input_frames &&
+		(src_data.input_frames_used || src_data.output_frames_gen));
+
+	return 0;
+}
+
+/* Take one block of a station through the single-thread pipeline.
+ * Returns -1 once the input has ended or the output failed.
+ */
+int8_t render_station_block(struct station_t *st) {
+	struct fused_pipeline_t *pl = &st->pipeline;
+	SRC_DATA src_data;
+	size_t frames;
+
+	if (st->in_src == NULL) {
+		fm_rds_get_samples(&st->mpx, pl->mpx, pl->frames);
+		return write_fused_block(st, pl->frames);
+	}
+
+	if (read_input(&st->input, pl->input) < 0) return -1;
+	short2float(pl->input, pl->audio, pl->frames*2);
+
+	memset(&src_data, 0, sizeof(SRC_DATA));
+	src_data.src_ratio = pl->in_ratio;
+	src_data.data_in = pl->audio;
+	src_data.input_frames = pl->frames;
+
+	do {
+		src_data.data_out = pl->resampled;
+		src_data.output_frames = pl->mpx_frames;
+		if (resample(st->in_src, &src_data) < 0) return -1;
+
+		src_data.data_in += src_data.input_frames_used*2;
+		src_data.input_frames -= src_data.input_frames_used;
+		frames = src_data.output_frames_gen;
+		fm_mpx_get_samples(&st->mpx, pl->resampled, pl->mpx, frames);
+		if (write_fused_block(st, frames) < 0) return -1;
+	} while (src_data.input_frames &&
+		(src_data.input_frames_used || src_data.output_frames_gen));
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATION_H
+#define STATION_H
+
+#include "resampler.h"
+#include "rds.h"
+#include "rds_modulator.h"
+#include "fm_mpx.h"
+#include "schedule.h"
+#include "sequencer.h"
+#include "control_pipe.h"
+#include "input.h"
+#include "output.h"
+
+// largest block of the single-thread pipeline
+#define MAX_FUSED_FRAMES	4096
+
+/* Single-thread pipeline
+ *
+ * One thread takes each block through every stage before it reads the
+ * next. Nothing is handed over between threads, so small blocks don't
+ * cost a context switch per stage and the buffers stay in cache. Block
+ * sizes after the resamplers vary a little from block to block.
+ */
+typedef struct fused_pipeline_t {
+	double in_ratio;
+	double out_ratio;
+	// frames read per block, or MPX frames per block without audio
+	size_t frames;
+	// room in the buffers after each resampler
+	size_t mpx_frames;
+	size_t out_frames;
+	short *input;
+	float *audio;
+	float *resampled;
+	float *mpx;
+	float *out;
+	short *output;
+	// how long samples take to get through
+	float ct_latency;
+	float audio_latency;
+} fused_pipeline_t;
+
+/*
+ * Station
+ *
+ * Everything one program stream needs: its RDS data, modulator, MPX
+ * generator, command handling and audio in and out. Stations share
+ * nothing but the DSP tables.
+ */
+typedef struct station_t {
+	struct rds_encoder_t rds;
+	struct rds_modulator_t modulator;
+	struct fm_mpx_t mpx;
+	struct command_schedule_t schedule;
+	struct command_sequencer_t sequencer;
+	struct control_pipe_t ctl;
+
+	// input.type is 0 without audio
+	struct input_t input;
+	struct output_t output;
+	// NULL until opened
+	SRC_STATE *in_src;
+	SRC_STATE *out_src;
+
+	struct fused_pipeline_t pipeline;
+} station_t;
+
+extern void init_station_tables();
+extern void init_station(struct station_t *st, uint8_t rds_streams);
+extern size_t get_fused_pipeline_memory(size_t frames);
+extern int8_t init_fused_pipeline(struct station_t *st, size_t frames,
+	uint32_t sample_rate);
+extern int8_t render_station_block(struct station_t *st);
+
+#endif /* STATION_H */
@@ -0,0 +1,246 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <limits.h>
+
+#include "station.h"
+#include "worker_pool.h"
+#include "event_loop.h"
+#include "arena.h"
+#include "buffers.h"
+#include "station_list.h"
+
+/*
+ * Station list
+ *
+ * Runs several stations in one process. Each line starting with
+ * "station" adds a station:
+ *
+ *   station AUDIO|none OUTPUT [CONTROL_PIPE]
+ *
+ * and the control commands on the lines after it set up its RDS data.
+ * Stations start with the defaults given on the command line. Blocks are
+ * rendered by the single-thread pipeline of each station, on a pool of
+ * worker threads sized to the CPUs.
+ */
+static char list_file[PATH_MAX];
+static uint8_t num_stations;
+static struct station_t *stations[MAX_STATIONS];
+static struct pool_task_t tasks[MAX_STATIONS];
+
+static char *skip_spaces(char *s) {
+	while (*s == ' ' || *s == '\t') s++;
+	return s;
+}
+
+/* Check the list and count the stations. Nothing is set up yet. */
+int8_t read_station_list(char *file) {
+	char line[CTL_BUFFER_SIZE + 16];
+	char *s;
+	uint16_t line_num = 0;
+	FILE *f;
+
+	f = fopen(file, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Could not open station list %s.\n", file);
+		return -1;
+	}
+
+	num_stations = 0;
+	while (fgets(line, sizeof(line), f)) {
+		line_num++;
+		s = skip_spaces(line);
+		if (*s == '#' || *s == '\n' || *s == 0) continue;
+		if (strncmp(s, "station", 7) != 0) {
+			if (!num_stations) {
+				fprintf(stderr, "%s:%u: command before the first "
+					"station.\n", file, line_num);
+				fclose(f);
+				return -1;
+			}
+			continue;
+		}
+		if (num_stations == MAX_STATIONS) {
+			fprintf(stderr, "%s: more than %u stations.\n",
+				file, MAX_STATIONS);
+			fclose(f);
+			return -1;
+		}
+		num_stations++;
+	}
+	fclose(f);
+
+	if (!num_stations) {
+		fprintf(stderr, "%s: no stations.\n", file);
+		return -1;
+	}
+
+	strncpy(list_file, file, PATH_MAX - 1);
+	return num_stations;
+}
+
+/* Arena memory the stations need, on top of the shared tables */
+size_t get_station_list_memory(size_t frames) {
+	return num_stations * (sizeof(struct station_t) + ARENA_ALIGN +
+		MPX_STATE_MEMORY_SIZE + get_fused_pipeline_memory(frames) +
+		// file input buffer
+		frames * 2 * sizeof(short) + ARENA_ALIGN);
+}
+
+static int8_t open_station(struct station_t *st, char *args,
+	uint8_t wait, size_t frames) {
+	char audio[64] = {0};
+	char output[64] = {0};
+	char ctl[51] = {0};
+	uint32_t sample_rate = 0;
+
+	if (sscanf(args, "%63s %63s %50s", audio, output, ctl) < 2) {
+		fprintf(stderr, "A station needs an input and an output.\n");
+		return -1;
+	}
+
+	if (open_output(&st->output, output, OUTPUT_SAMPLE_RATE, 2) < 0)
+		return -1;
+
+	if (strcmp(audio, "none") != 0) {
+		if (open_input(&st->input, audio, wait, &sample_rate,
+			frames) <= 0) return -1;
+		if (resampler_init(&st->in_src, 2) < 0) {
+			fprintf(stderr, "Could not create input resampler.\n");
+			return -1;
+		}
+	}
+	if (resampler_init(&st->out_src, 2) < 0) {
+		fprintf(stderr, "Could not create ouput resampler.\n");
+		return -1;
+	}
+	if (init_fused_pipeline(st, frames, sample_rate) < 0) return -1;
+
+	if (ctl[0]) {
+		if (open_control_pipe(&st->ctl, ctl, st) == 0) {
+			fprintf(stderr, "Reading control commands on %s.\n", ctl);
+		} else {
+			fprintf(stderr, "Failed to open control pipe: %s.\n", ctl);
+		}
+	}
+
+	return 0;
+}
+
+/* Set up every station of the list and run its commands */
+int8_t open_station_list(struct station_defaults_t *def) {
+	char line[CTL_BUFFER_SIZE + 16];
+	char *s;
+	uint16_t line_num = 0;
+	uint8_t n = 0;
+	struct station_t *st = NULL;
+	int8_t r = 0;
+	FILE *f;
+
+	f = fopen(list_file, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Could not open station list %s.\n", list_file);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		line_num++;
+		s = skip_spaces(line);
+		if (*s == '#' || *s == '\n' || *s == 0) continue;
+
+		if (strncmp(s, "station", 7) == 0) {
+			// the list may have changed since it was read
+			if (n == num_stations) break;
+			st = arena_alloc(sizeof(struct station_t));
+			if (st == NULL) {
+				r = -1;
+				break;
+			}
+			init_station(st, 1);
+			stations[n++] = st;
+
+			set_output_volume(&st->mpx, def->mpx);
+			if (!def->rds) set_carrier_volume(&st->mpx, 1, 0);
+			if (def->group_rates)
+				set_rds_group_rates(&st->rds, def->group_rates);
+			set_rds_params(&st->rds, def->rds_params, def->callsign);
+
+			fprintf(stderr, "Station %u:\n", n);
+			if (open_station(st, s + 7, def->wait, def->frames) < 0) {
+				r = -1;
+				break;
+			}
+			continue;
+		}
+
+		if (st == NULL) continue;
+		if (process_control_command(st, s) < 0) {
+			fprintf(stderr, "%s:%u: unknown command.\n",
+				list_file, line_num);
+		}
+	}
+	fclose(f);
+	num_stations = n;
+	if (r < 0) return -1;
+
+	for (uint8_t i = 0; i < num_stations; i++) {
+		fprintf(stderr, "Station %u ", i + 1);
+		show_rds_params(&stations[i]->rds);
+	}
+
+	return 0;
+}
+
+static int8_t run_station(void *arg) {
+	return render_station_block((struct station_t *)arg);
+}
+
+int8_t start_station_list(pthread_attr_t *attr) {
+	uint8_t workers;
+
+	workers = init_worker_pool(num_stations);
+	for (uint8_t i = 0; i < num_stations; i++) {
+		add_pool_task(&tasks[i], run_station, stations[i]);
+	}
+
+	fprintf(stderr, "Running %u stations on %u workers (%zu frame "
+		"blocks).\n", num_stations, workers,
+		stations[0]->pipeline.frames);
+
+	// stop once every station has ended
+	return start_worker_pool(attr, stop_event_loop);
+}
+
+void stop_station_list() {
+	stop_worker_pool();
+}
+
+void close_station_list() {
+	struct station_t *st;
+
+	for (uint8_t i = 0; i < num_stations; i++) {
+		st = stations[i];
+		close_control_pipe(&st->ctl);
+		if (st->input.type) close_input(&st->input);
+		if (st->output.type) close_output(&st->output);
+		if (st->in_src) resampler_exit(st->in_src);
+		if (st->out_src) resampler_exit(st->out_src);
+	}
+	num_stations = 0;
+}
@@ -0,0 +1,49 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATION_LIST_H
+#define STATION_LIST_H
+
+#include <pthread.h>
+#include "rds.h"
+
+#define MAX_STATIONS		32
+
+// block size of the stations unless --single-thread gives one
+#define DEFAULT_STATION_FRAMES	1024
+
+// what every station starts with, from the command line
+typedef struct station_defaults_t {
+	struct rds_params_t rds_params;
+	char *callsign;
+	// NULL for the encoder defaults
+	char *group_rates;
+	uint8_t mpx;
+	uint8_t rds;
+	uint8_t wait;
+	size_t frames;
+} station_defaults_t;
+
+extern int8_t read_station_list(char *file);
+extern size_t get_station_list_memory(size_t frames);
+extern int8_t open_station_list(struct station_defaults_t *def);
+extern int8_t start_station_list(pthread_attr_t *attr);
+extern void stop_station_list();
+extern void close_station_list();
+
+#endif /* STATION_LIST_H */
@@ -0,0 +1,107 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <limits.h>
+#include "rds.h"
+#include "rds_modulator.h"
+#include "station.h"
+#include "stats.h"
+
+/*
+ * Statistics output
+ *
+ * What the RDS channel is spent on, as counted by the encoder, and how
+ * the group FIFOs are doing. Intervals and change times are measured in
+ * groups and shown in seconds.
+ */
+static void print_stats(struct station_t *station, FILE *f) {
+	struct rds_modulator_t *mod = &station->modulator;
+	struct rds_stats_t st;
+	float avg;
+
+	get_rds_stats(&station->rds, &st);
+
+	fprintf(f, "groups: %llu (%.1f s)\n", (unsigned long long)st.groups,
+		st.groups / RDS_GROUP_RATE);
+
+	fprintf(f, "type  count  share  interval avg/max (s)\n");
+	for (uint8_t i = 0; i < NUM_GROUP_TYPES; i++) {
+		if (!st.count[i]) continue;
+		fprintf(f, "%2u%c %7u %5.1f%%", i >> 1, i & 1 ? 'B' : 'A',
+			st.count[i], 100.0f * st.count[i] / st.groups);
+		if (st.count[i] > 1) {
+			avg = (float)st.interval_sum[i] / (st.count[i] - 1);
+			fprintf(f, "  %.2f/%.2f", avg / RDS_GROUP_RATE,
+				st.interval_max[i] / RDS_GROUP_RATE);
+		}
+		fprintf(f, "\n");
+	}
+
+	if (st.ps_changes) {
+		fprintf(f, "PS changes: %u, sent in %.2f s avg, %.2f s max\n",
+			st.ps_changes,
+			(float)st.ps_change_sum / st.ps_changes / RDS_GROUP_RATE,
+			st.ps_change_max / RDS_GROUP_RATE);
+	}
+	if (st.rt_changes) {
+		fprintf(f, "RT changes: %u, sent in %.2f s avg, %.2f s max\n",
+			st.rt_changes,
+			(float)st.rt_change_sum / st.rt_changes / RDS_GROUP_RATE,
+			st.rt_change_max / RDS_GROUP_RATE);
+	}
+	fprintf(f, "filler: %u\n", st.filler);
+	fprintf(f, "repeats: %u\n", st.repeats);
+
+	for (uint8_t i = 0; i < mod->num_streams; i++) {
+		fprintf(f, "stream %u: FIFO depth %u, underruns %u\n", i,
+			get_rds_group_fifo_depth(mod, i),
+			get_rds_group_fifo_underruns(mod, i));
+	}
+	fprintf(f, "input: depth %u, underruns %u\n",
+		get_rds_input_depth(mod), get_rds_input_underruns(mod));
+}
+
+/* Write the stats to a file, or to stderr for "-". The file is replaced
+ * in one go so readers never see half of it.
+ */
+int8_t write_stats(struct station_t *station, char *file) {
+	char tmp[PATH_MAX];
+	FILE *f;
+
+	if (strcmp(file, "-") == 0) {
+		print_stats(station, stderr);
+		return 0;
+	}
+
+	snprintf(tmp, sizeof(tmp), "%s.tmp", file);
+	f = fopen(tmp, "w");
+	if (f == NULL) {
+		fprintf(stderr, "Could not write stats to %s.\n", tmp);
+		return -1;
+	}
+	print_stats(station, f);
+	fclose(f);
+
+	if (rename(tmp, file) < 0) {
+		fprintf(stderr, "Could not write stats to %s.\n", file);
+		return -1;
+	}
+
+	return 0;
+}
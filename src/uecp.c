@@ -0,0 +1,350 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include "rds.h"
+#include "rds_lib.h"
+#include "event_loop.h"
+#include "uecp.h"
+
+/*
+ * UECP (SPB 490) server
+ *
+ * Accepts one client at a time on a TCP port ("tcp:PORT") or a Unix
+ * socket. All messages of a frame are applied to the encoder as one
+ * update. The encoder holds a single data set and program service,
+ * which answers to DSN 0, 1 and 255 and PSN 0 and 1. There is one server
+ * per process, for one encoder.
+ */
+static struct rds_encoder_t *enc;
+static int listen_fd = -1;
+static int client_fd = -1;
+static uint16_t site_address;
+static uint8_t encoder_address;
+
+static struct {
+	uint8_t data[UECP_MAX_FRAME];
+	uint16_t len;
+	uint8_t in_frame;
+	uint8_t escape;
+} frame;
+
+static void accept_uecp_client(void *arg);
+
+int8_t open_uecp_server(struct rds_encoder_t *encoder_state, char *address,
+	uint16_t site, uint8_t encoder) {
+	struct sockaddr_in in_addr;
+	struct sockaddr_un un_addr;
+	int on = 1;
+	int r;
+
+	enc = encoder_state;
+	site_address = site & 0x3ff;
+	encoder_address = encoder & 0x3f;
+
+	if (strncmp(address, "tcp:", 4) == 0) {
+		memset(&in_addr, 0, sizeof(in_addr));
+		in_addr.sin_family = AF_INET;
+		in_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+		in_addr.sin_port = htons(strtoul(address + 4, NULL, 10));
+		listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (listen_fd < 0) goto error;
+		setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		r = bind(listen_fd, (struct sockaddr *)&in_addr, sizeof(in_addr));
+	} else {
+		memset(&un_addr, 0, sizeof(un_addr));
+		un_addr.sun_family = AF_UNIX;
+		strncpy(un_addr.sun_path, address, sizeof(un_addr.sun_path) - 1);
+		unlink(un_addr.sun_path);
+		listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (listen_fd < 0) goto error;
+		r = bind(listen_fd, (struct sockaddr *)&un_addr, sizeof(un_addr));
+	}
+
+	if (r < 0 || listen(listen_fd, 1) < 0) goto error;
+	if (add_event_fd(listen_fd, accept_uecp_client, NULL) < 0) goto error;
+
+	return 0;
+
+error:
+	fprintf(stderr, "Error: could not listen for UECP on %s.\n", address);
+	if (listen_fd >= 0) close(listen_fd);
+	listen_fd = -1;
+	return -1;
+}
+
+static uint8_t our_service(uint8_t dsn, uint8_t psn) {
+	return (dsn == UECP_DSN_CURRENT || dsn == 1 || dsn == UECP_DSN_ALL) &&
+		psn <= 1;
+}
+
+/* Build an AF list from RDS AF codes. Count and filler codes are
+ * dropped.
+ */
+static void set_af_codes(uint8_t *codes, uint8_t len) {
+	struct rds_af_t af_list;
+
+	memset(&af_list, 0, sizeof(struct rds_af_t));
+
+	for (uint8_t i = 0; i < len && af_list.num_afs < MAX_AFS; i++) {
+		if (codes[i] == AF_LFMF_FOLLOWS && i + 1 < len) {
+			af_list.afs[af_list.num_entries++] = AF_LFMF_FOLLOWS;
+			af_list.afs[af_list.num_entries++] = codes[++i];
+			af_list.num_afs++;
+		} else if (codes[i] >= 1 && codes[i] <= 204) {
+			af_list.afs[af_list.num_entries++] = codes[i];
+			af_list.num_afs++;
+		}
+	}
+
+	set_rds_af(enc, af_list);
+}
+
+/* Apply the messages of a frame
+ * Parsing stops at the first message that is unknown or cut short,
+ * since its length cannot be known.
+ */
+static void process_messages(uint8_t *msg, uint16_t len) {
+	uint16_t pos = 0;
+	uint8_t *m;
+	uint8_t mel;
+	char text[RT_LENGTH + 1];
+
+// checks that n bytes of the message are there
+#define NEED(n) if (pos + (n) > len) return
+
+	while (pos < len) {
+		m = &msg[pos];
+		switch (m[0]) {
+			case UECP_MEC_PI:
+				NEED(5);
+				if (our_service(m[1], m[2])) set_rds_pi(enc, m[3] << 8 | m[4]);
+				pos += 5;
+				break;
+
+			case UECP_MEC_PS:
+			case UECP_MEC_PTYN:
+				NEED(3 + PS_LENGTH);
+				if (our_service(m[1], m[2])) {
+					memcpy(text, &m[3], PS_LENGTH);
+					text[PS_LENGTH] = 0;
+					if (m[0] == UECP_MEC_PS) {
+						set_rds_ps(enc, text);
+					} else {
+						set_rds_ptyn(enc, text);
+					}
+				}
+				pos += 3 + PS_LENGTH;
+				break;
+
+			case UECP_MEC_TA_TP:
+				NEED(4);
+				if (our_service(m[1], m[2])) {
+					set_rds_ta(enc, m[3] & 1);
+					set_rds_tp(enc, (m[3] >> 1) & 1);
+				}
+				pos += 4;
+				break;
+
+			case UECP_MEC_DI:
+				NEED(4);
+				if (our_service(m[1], m[2])) set_rds_di(enc, m[3] & 15);
+				pos += 4;
+				break;
+
+			case UECP_MEC_MS:
+				NEED(4);
+				if (our_service(m[1], m[2])) set_rds_ms(enc, m[3] & 1);
+				pos += 4;
+				break;
+
+			case UECP_MEC_PTY:
+				NEED(4);
+				if (our_service(m[1], m[2])) set_rds_pty(enc, m[3] & 31);
+				pos += 4;
+				break;
+
+			case UECP_MEC_RT:
+				NEED(4);
+				mel = m[3];
+				NEED(4 + mel);
+				// configuration byte, then the text
+				if (our_service(m[1], m[2])) {
+					memset(text, 0, sizeof(text));
+					if (mel > 1) memcpy(text, &m[5],
+						mel - 1 > RT_LENGTH ? RT_LENGTH : mel - 1);
+					set_rds_rt(enc, text);
+				}
+				pos += 4 + mel;
+				break;
+
+			case UECP_MEC_AF:
+				NEED(4);
+				mel = m[3];
+				NEED(4 + mel);
+				/* control byte (bit 0 set deletes the list), the
+				 * transmitter the list belongs to, then AF codes
+				 */
+				if (our_service(m[1], m[2]) && mel >= 3) {
+					if (m[4] & 1) {
+						clear_rds_af(enc);
+					} else {
+						set_af_codes(&m[7], mel - 3);
+					}
+				}
+				pos += 4 + mel;
+				break;
+
+			case UECP_MEC_ODA:
+				NEED(2);
+				mel = m[1];
+				NEED(2 + mel);
+				// AID, group type code, message bits for block C
+				if (mel >= 5) {
+					set_rds_oda(enc, (m[4] >> 1) << 4 | (m[4] & 1),
+						m[2] << 8 | m[3], m[5] << 8 | m[6]);
+				}
+				pos += 2 + mel;
+				break;
+
+			default:
+				fprintf(stderr, "Unsupported UECP message %02X.\n", m[0]);
+				return;
+		}
+	}
+
+#undef NEED
+}
+
+static void process_frame() {
+	uint8_t *data = frame.data;
+	uint16_t address, site;
+	uint8_t encoder, mfl;
+
+	if (frame.len < 6) return;
+	mfl = data[3];
+	if (frame.len != 4 + mfl + 2) return;
+
+	// CRC-CCITT over ADD to the end of MSG, sent inverted
+	if ((crc16_ccitt(data, 4 + mfl) ^ 0xffff) !=
+		(data[4 + mfl] << 8 | data[5 + mfl])) {
+		fprintf(stderr, "UECP frame with bad CRC dropped.\n");
+		return;
+	}
+
+	/* 0 addresses every site or every encoder of a site. Without an
+	 * address of our own, every frame is taken.
+	 */
+	address = data[0] << 8 | data[1];
+	site = address >> 6;
+	encoder = address & 0x3f;
+	if ((site && site_address && site != site_address) ||
+		(encoder && encoder_address && encoder != encoder_address)) return;
+
+	begin_rds_update(enc);
+	process_messages(&data[4], mfl);
+	end_rds_update(enc);
+}
+
+static void process_byte(uint8_t c) {
+	if (c == UECP_STA) {
+		frame.in_frame = 1;
+		frame.escape = 0;
+		frame.len = 0;
+		return;
+	}
+	if (!frame.in_frame) return;
+
+	if (c == UECP_STP) {
+		frame.in_frame = 0;
+		process_frame();
+		return;
+	}
+
+	// FD 00, FD 01 and FD 02 stand for FD, FE and FF
+	if (frame.escape) {
+		frame.escape = 0;
+		if (c > 2) {
+			frame.in_frame = 0;
+			return;
+		}
+		c += UECP_STUFF;
+	} else if (c == UECP_STUFF) {
+		frame.escape = 1;
+		return;
+	}
+
+	if (frame.len == UECP_MAX_FRAME) {
+		frame.in_frame = 0;
+		return;
+	}
+	frame.data[frame.len++] = c;
+}
+
+static void read_uecp_client(void *arg) {
+	uint8_t buf[512];
+	ssize_t bytes;
+	(void)arg;
+
+	bytes = read(client_fd, buf, sizeof(buf));
+	if (bytes <= 0) {
+		fprintf(stderr, "UECP client disconnected.\n");
+		remove_event_fd(client_fd);
+		close(client_fd);
+		client_fd = -1;
+		// take the next client
+		add_event_fd(listen_fd, accept_uecp_client, NULL);
+		return;
+	}
+
+	for (ssize_t i = 0; i < bytes; i++) process_byte(buf[i]);
+}
+
+/* Called by the event loop when a client connects. While a client is
+ * connected the listening socket isn't watched, so others wait in the
+ * backlog.
+ */
+static void accept_uecp_client(void *arg) {
+	(void)arg;
+
+	client_fd = accept(listen_fd, NULL, NULL);
+	if (client_fd < 0) return;
+
+	if (add_event_fd(client_fd, read_uecp_client, NULL) < 0) {
+		close(client_fd);
+		client_fd = -1;
+		return;
+	}
+	remove_event_fd(listen_fd);
+	fprintf(stderr, "UECP client connected.\n");
+	frame.in_frame = 0;
+}
+
+void close_uecp_server() {
+	if (client_fd >= 0) {
+		remove_event_fd(client_fd);
+		close(client_fd);
+	}
+	if (listen_fd >= 0) {
+		remove_event_fd(listen_fd);
+		close(listen_fd);
+	}
+}
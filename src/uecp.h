@@ -0,0 +1,45 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Frame delimiters and byte stuffing */
+#define UECP_STA	0xFE
+#define UECP_STP	0xFF
+#define UECP_STUFF	0xFD
+
+/* ADD + SQC + MFL + MSG + CRC */
+#define UECP_MAX_FRAME	(2 + 1 + 1 + 255 + 2)
+
+/* Message element codes */
+#define UECP_MEC_PI	0x01
+#define UECP_MEC_PS	0x02
+#define UECP_MEC_TA_TP	0x03
+#define UECP_MEC_DI	0x04
+#define UECP_MEC_MS	0x05
+#define UECP_MEC_PTY	0x07
+#define UECP_MEC_RT	0x0A
+#define UECP_MEC_AF	0x13
+#define UECP_MEC_PTYN	0x3E
+#define UECP_MEC_ODA	0x40
+
+/* Data set numbers */
+#define UECP_DSN_CURRENT	0
+#define UECP_DSN_ALL		255
+
+extern int8_t open_uecp_server(struct rds_encoder_t *encoder_state,
+	char *address, uint16_t site, uint8_t encoder);
+extern void close_uecp_server();
@@ -0,0 +1,215 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.h"
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "realtime.h"
+#include "worker_pool.h"
+
+/*
+ * Work-stealing worker pool
+ *
+ * Every worker has its own queue of tasks. A worker runs the task at
+ * the head of its queue and puts it back at the tail, so the tasks it
+ * owns take turns. A worker whose queue is empty takes the task at the
+ * head of another queue, the one that has waited longest, and keeps it.
+ * Workers with nothing to do sleep until a task is queued again.
+ */
+typedef struct task_queue_t {
+	pthread_mutex_t mutex;
+	struct pool_task_t *head;
+	struct pool_task_t *tail;
+} __attribute__((aligned(CACHE_LINE_SIZE))) task_queue_t;
+
+static struct task_queue_t queues[MAX_POOL_WORKERS];
+static pthread_t workers[MAX_POOL_WORKERS];
+static uint8_t num_workers;
+static uint8_t num_started;
+// which queue the next task added goes to
+static uint8_t next_queue;
+
+// tasks on the queues, tasks not finished yet
+static uint32_t queued;
+static uint32_t active;
+static uint32_t sleeping;
+static uint32_t wake_seq;
+static uint8_t stopping;
+
+// called once every task has finished
+static void (*all_done)();
+
+/* Size the pool to the CPUs online, but no larger than max_workers.
+ * Returns the number of workers.
+ */
+uint8_t init_worker_pool(uint8_t max_workers) {
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (cpus < 1) cpus = 1;
+	if (cpus > MAX_POOL_WORKERS) cpus = MAX_POOL_WORKERS;
+	num_workers = cpus < max_workers ? cpus : max_workers;
+	if (num_workers < 1) num_workers = 1;
+
+	for (uint8_t i = 0; i < num_workers; i++) {
+		pthread_mutex_init(&queues[i].mutex, NULL);
+		queues[i].head = queues[i].tail = NULL;
+	}
+	next_queue = 0;
+	queued = active = sleeping = wake_seq = 0;
+	stopping = 0;
+
+	return num_workers;
+}
+
+static void push_task(struct task_queue_t *queue, struct pool_task_t *task) {
+	task->next = NULL;
+	pthread_mutex_lock(&queue->mutex);
+	if (queue->tail) {
+		queue->tail->next = task;
+	} else {
+		queue->head = task;
+	}
+	queue->tail = task;
+	pthread_mutex_unlock(&queue->mutex);
+}
+
+static struct pool_task_t *pop_task(struct task_queue_t *queue) {
+	struct pool_task_t *task;
+
+	pthread_mutex_lock(&queue->mutex);
+	task = queue->head;
+	if (task) {
+		queue->head = task->next;
+		if (queue->head == NULL) queue->tail = NULL;
+	}
+	pthread_mutex_unlock(&queue->mutex);
+
+	return task;
+}
+
+/* Spread the tasks over the workers, before the pool is started */
+void add_pool_task(struct pool_task_t *task, int8_t (*run)(void *arg),
+	void *arg) {
+	task->run = run;
+	task->arg = arg;
+	push_task(&queues[next_queue], task);
+	next_queue = (next_queue + 1) % num_workers;
+	queued++;
+	active++;
+}
+
+static struct pool_task_t *get_task(uint8_t self) {
+	struct pool_task_t *task;
+
+	task = pop_task(&queues[self]);
+	if (task) return task;
+
+	// steal from the others, starting with the next worker along
+	for (uint8_t i = 1; i < num_workers; i++) {
+		task = pop_task(&queues[(self + i) % num_workers]);
+		if (task) return task;
+	}
+
+	return NULL;
+}
+
+/* Sleep until a task may be there to steal. The side queueing a task
+ * checks the sleeping count after it has counted the task and bumps
+ * wake_seq before waking us, so a wakeup cannot be missed.
+ */
+static void wait_for_task() {
+	uint32_t seq;
+
+	__atomic_add_fetch(&sleeping, 1, __ATOMIC_SEQ_CST);
+	seq = __atomic_load_n(&wake_seq, __ATOMIC_SEQ_CST);
+	if (!__atomic_load_n(&queued, __ATOMIC_SEQ_CST) &&
+		!__atomic_load_n(&stopping, __ATOMIC_SEQ_CST)) {
+		syscall(SYS_futex, &wake_seq, FUTEX_WAIT_PRIVATE, seq,
+			NULL, NULL, 0);
+	}
+	__atomic_sub_fetch(&sleeping, 1, __ATOMIC_SEQ_CST);
+}
+
+static void wake_workers(int count) {
+	__atomic_add_fetch(&wake_seq, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &wake_seq, FUTEX_WAKE_PRIVATE, count,
+		NULL, NULL, 0);
+}
+
+static void *pool_worker(void *arg) {
+	uint8_t self = (uintptr_t)arg;
+	struct pool_task_t *task;
+
+	while (!__atomic_load_n(&stopping, __ATOMIC_ACQUIRE)) {
+		task = get_task(self);
+		if (task == NULL) {
+			wait_for_task();
+			continue;
+		}
+		__atomic_sub_fetch(&queued, 1, __ATOMIC_SEQ_CST);
+
+		if (task->run(task->arg) < 0) {
+			if (__atomic_sub_fetch(&active, 1, __ATOMIC_SEQ_CST) == 0 &&
+				all_done) all_done();
+			continue;
+		}
+
+		push_task(&queues[self], task);
+		/* we take one of our own tasks next, only wake someone if
+		 * there is more than that to go round
+		 */
+		if (__atomic_add_fetch(&queued, 1, __ATOMIC_SEQ_CST) > 1 &&
+			__atomic_load_n(&sleeping, __ATOMIC_SEQ_CST)) {
+			wake_workers(1);
+		}
+	}
+
+	pthread_exit(NULL);
+}
+
+int8_t start_worker_pool(pthread_attr_t *attr, void (*done)()) {
+	char name[16];
+
+	all_done = done;
+
+	for (uint8_t i = 0; i < num_workers; i++) {
+		if (pthread_create(&workers[i], attr, pool_worker,
+			(void *)(uintptr_t)i) != 0) {
+			fprintf(stderr, "Could not create worker thread.\n");
+			return -1;
+		}
+		snprintf(name, sizeof(name), "worker %u", i);
+		set_stage_thread(workers[i], STAGE_MPX, name);
+		num_started++;
+	}
+	fprintf(stderr, "Created %u worker threads.\n", num_workers);
+
+	return 0;
+}
+
+/* Let the workers finish the tasks they are running and wait for them */
+void stop_worker_pool() {
+	__atomic_store_n(&stopping, 1, __ATOMIC_SEQ_CST);
+	wake_workers(INT_MAX);
+
+	for (uint8_t i = 0; i < num_started; i++) {
+		pthread_join(workers[i], NULL);
+	}
+	num_started = 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * mpxgen - FM multiplex encoder with Stereo and RDS
+ * Copyright (C) 2021 Anthony96922
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <pthread.h>
+
+#define MAX_POOL_WORKERS	32
+
+/* A task is run over and over until it returns -1. It is only ever on
+ * one queue or being run by one worker, never both.
+ */
+typedef struct pool_task_t {
+	int8_t (*run)(void *arg);
+	void *arg;
+	struct pool_task_t *next;
+} pool_task_t;
+
+extern uint8_t init_worker_pool(uint8_t max_workers);
+extern void add_pool_task(struct pool_task_t *task, int8_t (*run)(void *arg),
+	void *arg);
+extern int8_t start_worker_pool(pthread_attr_t *attr, void (*done)());
+extern void stop_worker_pool();
+
+#endif /* WORKER_POOL_H */